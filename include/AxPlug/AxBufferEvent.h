@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AxEventBus.h"
+
+namespace AxPlug
+{
+
+// ============================================================
+// ByteSlice - refcounted, immutable view into a shared byte buffer
+//
+// Copying a slice or taking a sub-slice only bumps the refcount of the
+// backing buffer; the bytes themselves are never copied. The backing
+// buffer is released when the last slice referring to it goes away, so a
+// slice may be handed to any thread and outlive its producer.
+// ============================================================
+class ByteSlice
+{
+public:
+    ByteSlice() = default;
+
+    // Take ownership of an existing buffer (no copy)
+    static ByteSlice Adopt(std::vector<uint8_t>&& bytes)
+    {
+        auto holder = std::make_shared<std::vector<uint8_t>>(std::move(bytes));
+        const size_t size = holder->size();
+        return ByteSlice(std::shared_ptr<const uint8_t>(holder, holder->data()), size);
+    }
+
+    static ByteSlice Adopt(std::string&& bytes)
+    {
+        auto holder = std::make_shared<std::string>(std::move(bytes));
+        const size_t size = holder->size();
+        return ByteSlice(std::shared_ptr<const uint8_t>(holder, reinterpret_cast<const uint8_t*>(holder->data())), size);
+    }
+
+    // Reference memory owned elsewhere (e.g. a driver frame buffer); `owner`
+    // must keep [data, data + size) alive and unchanged
+    static ByteSlice Wrap(std::shared_ptr<const void> owner, const void* data, size_t size)
+    {
+        return ByteSlice(std::shared_ptr<const uint8_t>(std::move(owner), static_cast<const uint8_t*>(data)), size);
+    }
+
+    // Copy `size` bytes into a new backing buffer
+    static ByteSlice Copy(const void* data, size_t size)
+    {
+        std::vector<uint8_t> bytes(size);
+        if (size)
+            memcpy(bytes.data(), data, size);
+        return Adopt(std::move(bytes));
+    }
+
+    // Sub-range sharing the same backing buffer; clamped to this slice
+    ByteSlice Slice(size_t offset, size_t length = SIZE_MAX) const
+    {
+        if (offset > size_)
+            offset = size_;
+        if (length > size_ - offset)
+            length = size_ - offset;
+        return ByteSlice(std::shared_ptr<const uint8_t>(data_, data_.get() + offset), length);
+    }
+
+    const uint8_t* data() const { return data_.get(); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const uint8_t* begin() const { return data_.get(); }
+    const uint8_t* end() const { return data_.get() + size_; }
+    uint8_t operator[](size_t i) const { return data_.get()[i]; }
+
+    // Number of slices sharing the backing buffer
+    long UseCount() const { return data_.use_count(); }
+
+private:
+    ByteSlice(std::shared_ptr<const uint8_t> data, size_t size) : data_(std::move(data)), size_(size) {}
+
+    std::shared_ptr<const uint8_t> data_;
+    size_t size_ = 0;
+};
+
+// ============================================================
+// AxBufferEvent - standard payload for large binary data
+//
+// Carries one ByteSlice. Local DirectCall / Queued delivery passes the
+// event pointer, so every subscriber sees the same bytes. The network and
+// shared-memory transports recognise this type and send the slice straight
+// from its buffer instead of going through a Serialize() copy; on receipt
+// the slice points into the buffer the datagram was received into.
+//
+// The wire form is exactly `bytes`. Serialize/Deserialize are final so the
+// transports' fast path and the generic path always agree: put any
+// metadata (width, height, format...) at the front of the slice.
+// ============================================================
+class AxBufferEvent : public INetworkableEvent
+{
+public:
+    AxBufferEvent() = default;
+    explicit AxBufferEvent(ByteSlice slice) : bytes(std::move(slice)) {}
+
+    ByteSlice bytes;
+
+    std::string Serialize() const final
+    {
+        if (bytes.empty())
+            return std::string();
+        return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    void Deserialize(const std::string& data) final
+    {
+        bytes = ByteSlice::Copy(data.data(), data.size());
+    }
+
+    size_t SerializedSizeHint() const final { return bytes.size(); }
+
+    size_t SerializeTo(uint8_t* out, size_t capacity) const final
+    {
+        if (bytes.size() > capacity)
+            return SERIALIZE_OVERFLOW;
+        if (!bytes.empty())
+            memcpy(out, bytes.data(), bytes.size());
+        return bytes.size();
+    }
+
+    void DeserializeFrom(const uint8_t* data, size_t size) final
+    {
+        bytes = ByteSlice::Copy(data, size);
+    }
+};
+
+} // namespace AxPlug
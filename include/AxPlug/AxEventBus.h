@@ -1,10 +1,22 @@
 #pragma once
 
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <functional>
+#include <future>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AxEventPool.h"
+#include "AxInlineFunction.h"
 
 // AxCore DLL export/import control
 #ifdef AX_CORE_EXPORTS
@@ -41,8 +53,25 @@ public:
 
     // Sender identity: who published this event. nullptr = anonymous.
     void* sender = nullptr;
+
+    // Request/reply: stamped by IEventBus::RequestAsync, copied onto the reply
+    // by IEventBus::Reply. 0 = not a request.
+    uint64_t correlationId = 0;
 };
 
+// ============================================================
+// MakeEvent - construct a payload in its per-type slab pool
+// Control block and payload share one pooled block; the block is recycled
+// when the last reference (publisher, queue or subscriber) is released,
+// so steady-state publishing does no heap allocation.
+// ============================================================
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeEvent(Args&&... args)
+{
+    static_assert(std::is_base_of_v<AxEvent, T>, "T must derive from AxPlug::AxEvent");
+    return std::allocate_shared<T>(internal::EventPoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
 // ============================================================
 // EventConnection - RAII subscription handle (Lazy GC)
 // ============================================================
@@ -80,10 +109,58 @@ enum class DispatchMode
 };
 
 // ============================================================
-// EventCallback - consumer callback signature
+// EventPriority - lane selection for DispatchMode::Queued
+// Critical is always served first; Normal and Bulk share the remaining
+// loop time by weight, so control events never wait behind data bursts.
+// DirectCall ignores the priority.
+// ============================================================
+enum class EventPriority
+{
+    Critical, // Control plane: shutdown, configuration, commands
+    Normal,   // Default
+    Bulk      // Data plane: high-rate samples, telemetry
+};
+
+// ============================================================
+// LatencyStats / EventStats - per-eventId bus metrics (IEventBus::GetEventStats)
+// Percentiles come from log-bucketed histograms (<= 12.5% bucket width).
+// ============================================================
+struct LatencyStats
+{
+    uint64_t count = 0;
+    uint64_t p50Ns = 0;
+    uint64_t p99Ns = 0;
+    uint64_t p999Ns = 0;
+    uint64_t maxNs = 0;
+};
+
+struct EventStats
+{
+    uint64_t eventId = 0;
+    uint64_t publishes = 0;   // payloads published under this eventId
+    uint64_t deliveries = 0;  // callbacks run + mailbox deliveries accepted
+    uint64_t drops = 0;       // mailbox deliveries rejected because the inbox was full
+    uint32_t subscribers = 0; // currently active subscriptions
+    uint32_t quarantined = 0; // of those, demoted to a quarantine worker for being slow
+    LatencyStats callback;    // callback run time on the publisher / event loop thread
+    LatencyStats queueWait;   // DispatchMode::Queued: time spent waiting in the queue
+};
+
+// ============================================================
+// EventCallback - legacy consumer callback signature
+// Still accepted everywhere an EventHandler is expected.
 // ============================================================
 using EventCallback = std::function<void(std::shared_ptr<AxEvent>)>;
 
+// ============================================================
+// EventHandler - subscriber callback as stored by the bus
+// Move-only, small-buffer (captures up to 64 bytes stay inline), and the
+// payload is passed by const reference: fan-out does not copy the
+// shared_ptr per subscriber. Lambdas taking std::shared_ptr<AxEvent> by
+// value and EventCallback objects convert implicitly.
+// ============================================================
+using EventHandler = InlineFunction<void(const std::shared_ptr<AxEvent>&)>;
+
 // ============================================================
 // ExceptionHandler - out-of-band exception handler callback
 // Set via IEventBus::SetExceptionHandler to catch exceptions thrown
@@ -91,6 +168,196 @@ using EventCallback = std::function<void(std::shared_ptr<AxEvent>)>;
 // ============================================================
 using ExceptionHandler = std::function<void(const std::exception&)>;
 
+// ============================================================
+// ReplyHandler - continuation of IEventBus::RequestAsync
+// Called exactly once: with the reply on the thread that called Reply(),
+// or with nullptr when the request timed out.
+// ============================================================
+using ReplyHandler = InlineFunction<void(std::shared_ptr<AxEvent>)>;
+
+// ============================================================
+// EventMailbox - per-thread inbox for subscriber-thread delivery
+//
+// Bind a subscription to a mailbox with IEventBus::SubscribeOn: the bus
+// pushes matching events straight into this inbox (one handoff), and the
+// owning thread runs the callbacks by calling Drain() from its own loop.
+// Producers are lock-free (bounded MPSC ring); when the ring is full the
+// delivery is dropped and counted. Drain/WaitFor must only be called from
+// the single owner thread.
+// ============================================================
+class EventMailbox
+{
+public:
+    struct Delivery
+    {
+        std::shared_ptr<const EventHandler> handler; // keeps the subscription record alive
+        std::shared_ptr<AxEvent> payload;
+        const EventConnection* connection = nullptr; // owned by the same record as handler; skipped if disconnected before drain
+    };
+
+    // capacity is rounded up to a power of two
+    explicit EventMailbox(size_t capacity = 4096)
+    {
+        size_t cap = 2;
+        while (cap < capacity)
+            cap <<= 1;
+        mask_ = cap - 1;
+        cells_.reset(new Cell[cap]);
+        for (size_t i = 0; i < cap; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    EventMailbox(const EventMailbox&) = delete;
+    EventMailbox& operator=(const EventMailbox&) = delete;
+
+    // Optional wakeup hook for threads that do not block in WaitFor (e.g. a UI
+    // loop posting itself a message). Called on the producer thread, at most once
+    // per Drain cycle. Set before the mailbox is subscribed.
+    void SetNotifier(std::function<void()> notifier) { notifier_ = std::move(notifier); }
+
+    // Exceptions thrown by callbacks during Drain (stderr if unset)
+    void SetExceptionHandler(ExceptionHandler handler) { exceptionHandler_ = std::move(handler); }
+
+    // Producer side (any thread). Returns false if the mailbox is full.
+    bool Post(Delivery delivery)
+    {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;)
+        {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->delivery = std::move(delivery);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+
+        // Coalesced wakeup: only the first post after a Drain signals the owner
+        if (!signalled_.exchange(true, std::memory_order_acq_rel))
+        {
+            if (notifier_)
+                notifier_();
+            std::lock_guard<std::mutex> lock(waitMutex_);
+            waitCV_.notify_one();
+        }
+        return true;
+    }
+
+    // Owner thread: run up to maxCount pending callbacks, returns number run
+    size_t Drain(size_t maxCount = SIZE_MAX)
+    {
+        signalled_.store(false, std::memory_order_release);
+        size_t ran = 0;
+        Delivery d;
+        while (ran < maxCount && TryPop(d))
+        {
+            if (!d.connection || d.connection->IsActive())
+            {
+                try {
+                    (*d.handler)(d.payload);
+                } catch (const std::exception& e) {
+                    ReportException(e);
+                } catch (...) {
+                    static std::runtime_error unknownErr("[EventMailbox] Unknown non-std::exception caught in callback.");
+                    ReportException(unknownErr);
+                }
+                ++ran;
+            }
+            d = Delivery{};
+        }
+        return ran;
+    }
+
+    // Owner thread: block until something is posted or timeout elapses
+    bool WaitFor(std::chrono::milliseconds timeout)
+    {
+        if (HasPending())
+            return true;
+        std::unique_lock<std::mutex> lock(waitMutex_);
+        return waitCV_.wait_for(lock, timeout, [this]() { return signalled_.load(std::memory_order_acquire); });
+    }
+
+    // Owner thread: whether a delivery is ready to drain
+    bool HasPending() const
+    {
+        const Cell& cell = cells_[dequeuePos_ & mask_];
+        return cell.sequence.load(std::memory_order_acquire) == dequeuePos_ + 1;
+    }
+
+    uint64_t DroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence{ 0 };
+        Delivery delivery;
+    };
+
+    bool TryPop(Delivery& out)
+    {
+        Cell& cell = cells_[dequeuePos_ & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1)
+            return false;
+        out = std::move(cell.delivery);
+        cell.delivery = Delivery{};
+        cell.sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+        ++dequeuePos_;
+        return true;
+    }
+
+    void ReportException(const std::exception& e)
+    {
+        if (exceptionHandler_)
+        {
+            try { exceptionHandler_(e); } catch (...) { fprintf(stderr, "[EventMailbox CRITICAL] Exception handler itself threw.\n"); }
+        }
+        else
+        {
+            fprintf(stderr, "[EventMailbox] Unhandled callback exception: %s\n", e.what());
+        }
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> enqueuePos_{ 0 };
+    alignas(64) size_t dequeuePos_ = 0;
+    std::atomic<bool> signalled_{ false };
+    std::atomic<uint64_t> dropped_{ 0 };
+    std::mutex waitMutex_;
+    std::condition_variable waitCV_;
+    std::function<void()> notifier_;
+    ExceptionHandler exceptionHandler_;
+};
+
+using EventMailboxPtr = std::shared_ptr<EventMailbox>;
+
+class INetworkableEvent;
+
+// Factory creating an empty networkable payload to Deserialize a journaled event into
+using JournalEventFactory = std::function<std::shared_ptr<INetworkableEvent>()>;
+
+// One entry of IEventBus::SubscribeBulk
+struct SubscriptionRequest
+{
+    uint64_t eventId = 0;
+    EventHandler handler;
+    void* specificSender = nullptr;
+};
+
 // ============================================================
 // IEventBus - abstract event bus interface
 // ============================================================
@@ -99,12 +366,226 @@ class IEventBus
 public:
     virtual ~IEventBus() = default;
 
-    // Publish an event (sync or async)
-    virtual void Publish(uint64_t eventId, std::shared_ptr<AxEvent> payload, DispatchMode mode = DispatchMode::DirectCall) = 0;
+    // Publish an event (sync or async). priority selects the Queued lane.
+    virtual void Publish(uint64_t eventId, std::shared_ptr<AxEvent> payload, DispatchMode mode = DispatchMode::DirectCall, EventPriority priority = EventPriority::Normal) = 0;
+
+    // Publish a batch of payloads under one eventId, delivered in order.
+    // Implementations pay the subscriber lookup and bookkeeping once per batch;
+    // Queued mode enqueues the whole batch with a single wakeup.
+    virtual void PublishBatch(uint64_t eventId, const std::shared_ptr<AxEvent>* payloads, size_t count, DispatchMode mode = DispatchMode::DirectCall, EventPriority priority = EventPriority::Normal)
+    {
+        for (size_t i = 0; i < count; ++i)
+            Publish(eventId, payloads[i], mode, priority);
+    }
 
     // Subscribe to an event. Keep the returned EventConnectionPtr alive to stay subscribed.
     // If specificSender != nullptr, only events from that sender trigger callback.
-    virtual EventConnectionPtr Subscribe(uint64_t eventId, EventCallback callback, void* specificSender = nullptr) = 0;
+    virtual EventConnectionPtr Subscribe(uint64_t eventId, EventHandler handler, void* specificSender = nullptr) = 0;
+
+    // Subscribe many handlers at once (e.g. during reconfiguration). Returns one
+    // handle per request, in order. Implementations take their subscriber lock
+    // once and update each event's table once for the whole set.
+    virtual std::vector<EventConnectionPtr> SubscribeBulk(std::vector<SubscriptionRequest> requests)
+    {
+        std::vector<EventConnectionPtr> conns;
+        conns.reserve(requests.size());
+        for (auto& req : requests)
+            conns.push_back(Subscribe(req.eventId, std::move(req.handler), req.specificSender));
+        return conns;
+    }
+
+    // Subscribe with subscriber-thread delivery: matching events are pushed straight
+    // into `mailbox` (regardless of the publisher's DispatchMode) and the callback
+    // runs on whichever thread drains it. Queued publishes skip the bus thread hop.
+    virtual EventConnectionPtr SubscribeOn(uint64_t eventId, EventMailboxPtr mailbox, EventHandler handler, void* specificSender = nullptr)
+    {
+        if (!mailbox || !handler)
+            return nullptr;
+        // Fallback for buses without native mailbox support: forward from the bus callback.
+        // The record's own connection gates deliveries still sitting in the mailbox.
+        struct Record { EventConnection connection; EventHandler handler; };
+        auto record = std::make_shared<Record>();
+        record->handler = std::move(handler);
+        std::shared_ptr<const EventHandler> sharedHandler(record, &record->handler);
+        auto inner = Subscribe(eventId, [mailbox, sharedHandler, record](const std::shared_ptr<AxEvent>& payload) {
+            mailbox->Post({ sharedHandler, payload, &record->connection });
+        }, specificSender);
+        if (!inner)
+            return nullptr;
+        return EventConnectionPtr(&record->connection, [record, inner](EventConnection* conn) {
+            conn->Disconnect();
+            inner->Disconnect();
+        });
+    }
+
+    // Declare a hierarchical topic ("Camera::Frame::Raw", levels separated by "::")
+    // and return its event ID, which equals HashEventId(name). Only registered
+    // topics are matched by SubscribePattern; registering twice is harmless.
+    virtual uint64_t RegisterTopic(const char* name)
+    {
+        return HashEventId(name);
+    }
+
+    // Subscribe to every registered topic under a prefix: "Camera::*" matches
+    // "Camera::Frame" and "Camera::Frame::Raw", "*" matches all registered topics.
+    // Topics registered after the call are picked up too. A pattern without
+    // '*' is a plain Subscribe to HashEventId(pattern).
+    virtual EventConnectionPtr SubscribePattern(const char* pattern, EventHandler handler, void* specificSender = nullptr)
+    {
+        for (const char* p = pattern; *p; ++p)
+        {
+            if (*p == '*')
+            {
+                fprintf(stderr, "[EventBus] SubscribePattern wildcards are not supported by this bus implementation.\n");
+                return nullptr;
+            }
+        }
+        return Subscribe(HashEventId(pattern), std::move(handler), specificSender);
+    }
+
+    // Publish `payload` once after `delay` (Queued, on the bus event loop).
+    // Keep the returned handle alive; Disconnect() or releasing it cancels.
+    virtual EventConnectionPtr PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxEvent> payload, EventPriority priority = EventPriority::Normal)
+    {
+        (void)delay; (void)eventId; (void)payload; (void)priority;
+        fprintf(stderr, "[EventBus] PublishAfter is not supported by this bus implementation.\n");
+        return nullptr;
+    }
+
+    // Publish the same `payload` every `period` until the returned handle is
+    // disconnected or released. First publish happens one period from now.
+    virtual EventConnectionPtr PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxEvent> payload, EventPriority priority = EventPriority::Normal)
+    {
+        (void)period; (void)eventId; (void)payload; (void)priority;
+        fprintf(stderr, "[EventBus] PublishEvery is not supported by this bus implementation.\n");
+        return nullptr;
+    }
+
+    // Run `task` on the bus's event loop thread after `delay`, then every
+    // `period` (0 = once). A zero delay posts it to the loop as soon as
+    // possible. Keep the returned handle alive; releasing it cancels.
+    virtual EventConnectionPtr ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, InlineFunction<void()> task)
+    {
+        (void)delay; (void)period; (void)task;
+        fprintf(stderr, "[EventBus] ScheduleTask is not supported by this bus implementation.\n");
+        return nullptr;
+    }
+
+    // Request/reply: publish `payload` stamped with a fresh correlationId and
+    // call `onReply` once with the subscriber's Reply(), or with nullptr after
+    // `timeout`. The reply goes straight to `onReply` on the replying thread
+    // (no second publish). Returns the correlationId, 0 if not supported.
+    virtual uint64_t RequestAsync(uint64_t eventId, std::shared_ptr<AxEvent> payload, std::chrono::milliseconds timeout, ReplyHandler onReply, DispatchMode mode = DispatchMode::DirectCall)
+    {
+        (void)eventId; (void)payload; (void)timeout; (void)mode;
+        fprintf(stderr, "[EventBus] RequestAsync is not supported by this bus implementation.\n");
+        if (onReply)
+            onReply(nullptr);
+        return 0;
+    }
+
+    // Answer a request from inside its subscriber (or later, from any thread).
+    // Returns false if `request` is not a request, or it was already answered
+    // or timed out.
+    virtual bool Reply(const AxEvent& request, std::shared_ptr<AxEvent> reply)
+    {
+        (void)request; (void)reply;
+        return false;
+    }
+
+    // Future flavour of RequestAsync. get() yields nullptr on timeout.
+    std::future<std::shared_ptr<AxEvent>> Request(uint64_t eventId, std::shared_ptr<AxEvent> payload, std::chrono::milliseconds timeout, DispatchMode mode = DispatchMode::DirectCall)
+    {
+        auto promise = std::make_shared<std::promise<std::shared_ptr<AxEvent>>>();
+        auto future = promise->get_future();
+        RequestAsync(eventId, std::move(payload), timeout, [promise](std::shared_ptr<AxEvent> reply) { promise->set_value(std::move(reply)); }, mode);
+        return future;
+    }
+
+    // Open (or create) a memory-mapped event journal of about `capacityBytes` at
+    // `path`. A journal left by an earlier run with the same capacity is continued,
+    // so events recorded before a crash can still be replayed.
+    virtual bool OpenJournal(const char* path, size_t capacityBytes)
+    {
+        (void)path; (void)capacityBytes;
+        fprintf(stderr, "[EventBus] OpenJournal is not supported by this bus implementation.\n");
+        return false;
+    }
+
+    // Safe to call from a subscriber running under ReplayJournal on the same
+    // thread: the journal is then closed once the replay returns. OpenJournal
+    // from such a subscriber fails.
+    virtual void CloseJournal() {}
+
+    // Record INetworkableEvent payloads published under `eventId` (eventId, sender,
+    // timestamp, Serialize() bytes). `factory` recreates the payload on replay.
+    virtual bool JournalEvent(uint64_t eventId, JournalEventFactory factory)
+    {
+        (void)eventId; (void)factory;
+        return false;
+    }
+
+    // Re-publish journaled events stamped within [from, to], in journal order.
+    // Replayed events are not journaled again. Returns the number published.
+    virtual size_t ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, DispatchMode mode = DispatchMode::DirectCall)
+    {
+        (void)from; (void)to; (void)mode;
+        return 0;
+    }
+
+    // Opt `eventId` into parallel DirectCall fan-out: its subscribers are spread
+    // over a worker pool and Publish returns once all of them have run, so the
+    // publisher waits roughly for the slowest callback instead of the sum.
+    // Subscribers of a parallel event must not depend on each other's order.
+    virtual bool SetParallelDispatch(uint64_t eventId, bool enabled)
+    {
+        (void)eventId; (void)enabled;
+        return false;
+    }
+
+    // Make `eventId` sticky: the bus keeps the last published payload and hands
+    // it to every new subscriber from inside Subscribe (on the subscribing
+    // thread, or via its mailbox), so late joiners see the current state
+    // without asking the publisher. Disabling drops the stored payload.
+    virtual bool SetSticky(uint64_t eventId, bool enabled)
+    {
+        (void)eventId; (void)enabled;
+        return false;
+    }
+
+    // Metrics for one eventId. Returns false if the bus has never seen it
+    // (or does not collect metrics).
+    virtual bool GetEventStats(uint64_t eventId, EventStats& stats)
+    {
+        (void)eventId; (void)stats;
+        return false;
+    }
+
+    // Metrics for every eventId the bus has seen
+    virtual std::vector<EventStats> GetAllEventStats()
+    {
+        return {};
+    }
+
+    // Live subscribers of each of `eventIds` into `counts` (0 for ids never seen).
+    // Cheap next to GetAllEventStats: no histograms are read. Returns false if
+    // the bus does not track subscribers.
+    virtual bool GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts)
+    {
+        (void)eventIds; (void)count; (void)counts;
+        return false;
+    }
+
+    // Slow-subscriber watchdog: a direct callback that runs longer than
+    // `budget` on `strikes` consecutive deliveries is moved to its own worker
+    // thread and queue (EVENT_SUBSCRIBER_QUARANTINED is published), so it no
+    // longer delays the publisher or the other subscribers. From then on its
+    // callbacks run asynchronously, in order. Off by default (strikes = 0);
+    // hosts opt in with a non-zero `strikes`.
+    virtual void SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes)
+    {
+        (void)budget; (void)strikes;
+    }
 
     // Set a global exception handler for out-of-band exception isolation.
     // When a subscriber callback throws, the exception is caught and routed
@@ -123,6 +604,81 @@ public:
 
     virtual std::string Serialize() const = 0;
     virtual void Deserialize(const std::string& data) = 0;
+
+    // Span API used by the transports. The defaults go through Serialize() /
+    // Deserialize(); derive from INetworkableEventV2 to skip the std::string.
+    static constexpr size_t SERIALIZE_OVERFLOW = SIZE_MAX;
+
+    // Upper bound of SerializeTo's output; 0 = unknown (transports use Serialize())
+    virtual size_t SerializedSizeHint() const { return 0; }
+
+    // Write into [out, out + capacity); returns the bytes written or SERIALIZE_OVERFLOW
+    virtual size_t SerializeTo(uint8_t* out, size_t capacity) const
+    {
+        std::string bytes = Serialize();
+        if (bytes.size() > capacity)
+            return SERIALIZE_OVERFLOW;
+        if (!bytes.empty())
+            memcpy(out, bytes.data(), bytes.size());
+        return bytes.size();
+    }
+
+    virtual void DeserializeFrom(const uint8_t* data, size_t size)
+    {
+        Deserialize(std::string(reinterpret_cast<const char*>(data), size));
+    }
+
+    // Serialize through SerializeTo into `out`, growing it to the size hint and
+    // keeping its capacity for the next call. False without a hint or on overflow.
+    bool SerializeInto(std::vector<uint8_t>& out, size_t& size) const
+    {
+        const size_t hint = SerializedSizeHint();
+        if (hint == 0)
+            return false;
+        if (out.size() < hint)
+            out.resize(hint);
+        size = SerializeTo(out.data(), out.size());
+        return size != SERIALIZE_OVERFLOW;
+    }
+};
+
+// ============================================================
+// INetworkableEventV2 - networkable event serialized through spans
+//
+// Implement the size hint and the two span functions; the std::string
+// Serialize/Deserialize are derived from them for code that still uses
+// the v1 calls. Transports serialize straight into a reused buffer and
+// deserialize from the received bytes, without an intermediate string.
+// ============================================================
+class INetworkableEventV2 : public INetworkableEvent
+{
+public:
+    size_t SerializedSizeHint() const override = 0;
+    size_t SerializeTo(uint8_t* out, size_t capacity) const override = 0;
+    void DeserializeFrom(const uint8_t* data, size_t size) override = 0;
+
+    std::string Serialize() const final
+    {
+        // The hint should be an upper bound; grow if it was not
+        std::string bytes(SerializedSizeHint(), '\0');
+        for (;;)
+        {
+            const size_t size = SerializeTo(reinterpret_cast<uint8_t*>(&bytes[0]), bytes.size());
+            if (size != SERIALIZE_OVERFLOW)
+            {
+                bytes.resize(size);
+                return bytes;
+            }
+            if (bytes.size() > (size_t(1) << 30))
+                return std::string();
+            bytes.resize(bytes.size() * 2 + 256);
+        }
+    }
+
+    void Deserialize(const std::string& data) final
+    {
+        DeserializeFrom(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    }
 };
 
 // ============================================================
@@ -132,6 +688,7 @@ constexpr uint64_t EVENT_SYSTEM_INIT    = HashEventId("Core::SystemInit");
 constexpr uint64_t EVENT_PLUGIN_LOADED  = HashEventId("Core::PluginLoaded");
 constexpr uint64_t EVENT_PLUGIN_UNLOADED = HashEventId("Core::PluginUnloaded");
 constexpr uint64_t EVENT_SYSTEM_SHUTDOWN = HashEventId("Core::SystemShutdown");
+constexpr uint64_t EVENT_SUBSCRIBER_QUARANTINED = HashEventId("Core::SubscriberQuarantined");
 
 // ============================================================
 // Framework core event payloads
@@ -151,6 +708,14 @@ public:
 
 class SystemShutdownEvent : public AxEvent {};
 
+// Published (Queued) when the slow-subscriber watchdog demotes a callback
+class SubscriberQuarantinedEvent : public AxEvent
+{
+public:
+    uint64_t eventId = 0;        // event the slow subscriber was attached to
+    uint64_t lastCallbackUs = 0; // duration of the callback that triggered it
+};
+
 // ============================================================
 // Example networkable event (Phase 4)
 // ============================================================
@@ -0,0 +1,376 @@
+#pragma once
+
+// ============================================================
+// AxEventCoro - C++20 coroutine layer over IEventBus
+//
+// Lets a protocol state machine be written as straight-line code instead of
+// a thread + mutex + condition variable per protocol:
+//
+//   AxPlug::Coro::Task RunHandshake(AxPlug::IEventBus& bus)
+//   {
+//       bus.Publish(EVENT_HELLO, AxPlug::MakeEvent<HelloEvent>());
+//       auto ack = co_await AxPlug::Coro::Next(bus, EVENT_HELLO_ACK, nullptr, std::chrono::milliseconds(500));
+//       if (!ack) co_return;                              // timed out
+//       co_await AxPlug::Coro::Delay(bus, std::chrono::milliseconds(10));
+//       ...
+//   }
+//
+// By default a coroutine continues on the bus event loop thread, so every
+// step of every coroutine runs on that one thread and needs no locking.
+// Only for hosts compiled as C++20; the rest of AxPlug stays C++17.
+// ============================================================
+
+#if !defined(__cpp_impl_coroutine) || __cpp_impl_coroutine < 201902L
+#error "AxEventCoro.h requires C++20 coroutines (/std:c++20 or -std=c++20)"
+#endif
+
+#include "AxEventBus.h"
+#include <coroutine>
+#include <deque>
+#include <exception>
+
+namespace AxPlug
+{
+namespace Coro
+{
+
+// Where a suspended coroutine continues once its event arrives
+enum class ResumeOn
+{
+    EventLoop, // bus event loop thread (default)
+    Inline     // the thread that published / replied (lowest latency, no thread hop)
+};
+
+// ============================================================
+// Task - fire-and-forget coroutine
+// Starts running immediately and frees itself when it finishes.
+// Exceptions escaping the body are logged to stderr.
+// ============================================================
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept
+        {
+            try {
+                throw;
+            } catch (const std::exception& e) {
+                fprintf(stderr, "[EventBus] Unhandled exception in coroutine: %s\n", e.what());
+            } catch (...) {
+                fprintf(stderr, "[EventBus] Unknown exception in coroutine.\n");
+            }
+        }
+    };
+};
+
+namespace internal
+{
+
+// ============================================================
+// ResumeState - hand-off between a suspending awaiter and whatever completes it
+// The first completion wins. Of {completion, end of await_suspend}, whichever
+// comes second resumes the coroutine, so a completion that fires while the
+// awaiter is still subscribing never resumes a coroutine that has not
+// finished suspending.
+// ============================================================
+struct ResumeState : std::enable_shared_from_this<ResumeState>
+{
+    IEventBus* bus = nullptr;
+    ResumeOn resumeOn = ResumeOn::EventLoop;
+    std::coroutine_handle<> handle;
+    std::shared_ptr<AxEvent> result;
+    std::atomic<bool> completed{ false };
+    std::atomic<bool> handoff{ false };
+    EventConnectionPtr resumeTask;
+
+    // `onLoopThread`: the caller is a bus timer task, so EventLoop resumption needs no post
+    void Complete(std::shared_ptr<AxEvent> value, bool onLoopThread)
+    {
+        if (completed.exchange(true, std::memory_order_acq_rel))
+            return;
+        result = std::move(value);
+        if (handoff.exchange(true, std::memory_order_acq_rel))
+            Resume(onLoopThread);
+    }
+
+    // Last step of await_suspend; its result is await_suspend's return value
+    bool Suspend()
+    {
+        if (!handoff.exchange(true, std::memory_order_acq_rel))
+            return true; // the completion will resume us
+        if (resumeOn == ResumeOn::Inline)
+            return false;
+        Resume(false);
+        return true;
+    }
+
+    void Resume(bool onLoopThread)
+    {
+        if (resumeOn == ResumeOn::EventLoop && !onLoopThread)
+        {
+            auto self = shared_from_this(); // the coroutine may finish before ScheduleTask returns
+            auto h = handle;
+            resumeTask = bus->ScheduleTask(std::chrono::milliseconds(0), std::chrono::milliseconds(0), [h]() { h.resume(); });
+            if (resumeTask)
+                return;
+        }
+        handle.resume();
+    }
+};
+
+inline std::shared_ptr<ResumeState> MakeResumeState(IEventBus& bus, ResumeOn resumeOn)
+{
+    auto state = std::make_shared<ResumeState>();
+    state->bus = &bus;
+    state->resumeOn = resumeOn;
+    return state;
+}
+
+} // namespace internal
+
+// ============================================================
+// NextAwaiter - co_await the next publish of one eventId
+// Yields the payload, or nullptr when `timeout` (if non-zero) expires first.
+// Only events published after the co_await are seen; use EventStream to
+// keep events that arrive between two awaits.
+// ============================================================
+class NextAwaiter
+{
+public:
+    NextAwaiter(IEventBus& bus, uint64_t eventId, void* sender, std::chrono::milliseconds timeout, ResumeOn resumeOn)
+        : bus_(&bus), eventId_(eventId), sender_(sender), timeout_(timeout), state_(internal::MakeResumeState(bus, resumeOn))
+    {
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        auto state = state_;
+        state->handle = handle;
+        conn_ = bus_->Subscribe(eventId_, [state](const std::shared_ptr<AxEvent>& e) { state->Complete(e, false); }, sender_);
+        if (timeout_.count() > 0)
+            timer_ = bus_->ScheduleTask(timeout_, std::chrono::milliseconds(0), [state]() { state->Complete(nullptr, true); });
+        return state->Suspend();
+    }
+
+    std::shared_ptr<AxEvent> await_resume()
+    {
+        conn_.reset();
+        timer_.reset();
+        return std::move(state_->result);
+    }
+
+private:
+    IEventBus* bus_;
+    uint64_t eventId_;
+    void* sender_;
+    std::chrono::milliseconds timeout_;
+    std::shared_ptr<internal::ResumeState> state_;
+    EventConnectionPtr conn_;
+    EventConnectionPtr timer_;
+};
+
+inline NextAwaiter Next(IEventBus& bus, uint64_t eventId, void* specificSender = nullptr, std::chrono::milliseconds timeout = std::chrono::milliseconds(0), ResumeOn resumeOn = ResumeOn::EventLoop)
+{
+    return NextAwaiter(bus, eventId, specificSender, timeout, resumeOn);
+}
+
+// ============================================================
+// RequestAwaiter - co_await IEventBus::RequestAsync; nullptr on timeout
+// ============================================================
+class RequestAwaiter
+{
+public:
+    RequestAwaiter(IEventBus& bus, uint64_t eventId, std::shared_ptr<AxEvent> payload, std::chrono::milliseconds timeout, ResumeOn resumeOn)
+        : bus_(&bus), eventId_(eventId), payload_(std::move(payload)), timeout_(timeout), state_(internal::MakeResumeState(bus, resumeOn))
+    {
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        auto state = state_;
+        state->handle = handle;
+        // Timeouts are completed by a bus timer task, i.e. already on the loop thread
+        bus_->RequestAsync(eventId_, std::move(payload_), timeout_, [state](std::shared_ptr<AxEvent> reply) {
+            bool timedOut = reply == nullptr;
+            state->Complete(std::move(reply), timedOut);
+        });
+        return state->Suspend();
+    }
+
+    std::shared_ptr<AxEvent> await_resume() { return std::move(state_->result); }
+
+private:
+    IEventBus* bus_;
+    uint64_t eventId_;
+    std::shared_ptr<AxEvent> payload_;
+    std::chrono::milliseconds timeout_;
+    std::shared_ptr<internal::ResumeState> state_;
+};
+
+inline RequestAwaiter Request(IEventBus& bus, uint64_t eventId, std::shared_ptr<AxEvent> payload, std::chrono::milliseconds timeout, ResumeOn resumeOn = ResumeOn::EventLoop)
+{
+    return RequestAwaiter(bus, eventId, std::move(payload), timeout, resumeOn);
+}
+
+// ============================================================
+// DelayAwaiter - resume on the event loop thread after `delay`
+// Delay(bus, 0ms) just moves the coroutine onto the event loop thread.
+// ============================================================
+class DelayAwaiter
+{
+public:
+    DelayAwaiter(IEventBus& bus, std::chrono::milliseconds delay)
+        : bus_(&bus), delay_(delay), state_(internal::MakeResumeState(bus, ResumeOn::EventLoop))
+    {
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        auto state = state_;
+        state->handle = handle;
+        timer_ = bus_->ScheduleTask(delay_, std::chrono::milliseconds(0), [state]() { state->Complete(nullptr, true); });
+        if (!timer_)
+            return false; // bus has no event loop: carry on here
+        return state->Suspend();
+    }
+
+    void await_resume() { timer_.reset(); }
+
+private:
+    IEventBus* bus_;
+    std::chrono::milliseconds delay_;
+    std::shared_ptr<internal::ResumeState> state_;
+    EventConnectionPtr timer_;
+};
+
+inline DelayAwaiter Delay(IEventBus& bus, std::chrono::milliseconds delay)
+{
+    return DelayAwaiter(bus, delay);
+}
+
+inline DelayAwaiter SwitchToEventLoop(IEventBus& bus)
+{
+    return DelayAwaiter(bus, std::chrono::milliseconds(0));
+}
+
+// ============================================================
+// EventStream - async generator over one eventId
+// Subscribes on construction and buffers events between awaits, so a
+// consumer looping on `co_await stream.Next()` misses nothing (up to
+// `capacity` buffered events; beyond that the oldest is dropped).
+// One consumer at a time: do not await Next() twice concurrently.
+//
+//   AxPlug::Coro::EventStream samples(bus, EVENT_SAMPLE);
+//   for (;;) { auto e = co_await samples.Next(); ... }
+// ============================================================
+class EventStream
+{
+    struct Shared
+    {
+        std::mutex mutex;
+        std::deque<std::shared_ptr<AxEvent>> queue;
+        std::shared_ptr<internal::ResumeState> waiter;
+        size_t capacity = 0;
+        std::atomic<uint64_t> dropped{ 0 };
+    };
+
+public:
+    class NextAwaiter
+    {
+    public:
+        explicit NextAwaiter(EventStream& stream) : stream_(&stream) {}
+
+        bool await_ready()
+        {
+            std::lock_guard<std::mutex> lock(stream_->shared_->mutex);
+            auto& queue = stream_->shared_->queue;
+            if (queue.empty())
+                return false;
+            ready_ = std::move(queue.front());
+            queue.pop_front();
+            return true;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            auto state = internal::MakeResumeState(*stream_->bus_, stream_->resumeOn_);
+            state->handle = handle;
+            state_ = state;
+            {
+                std::lock_guard<std::mutex> lock(stream_->shared_->mutex);
+                auto& queue = stream_->shared_->queue;
+                if (!queue.empty())
+                {
+                    // Arrived between await_ready and now
+                    state->result = std::move(queue.front());
+                    queue.pop_front();
+                    return false;
+                }
+                stream_->shared_->waiter = state;
+            }
+            return state->Suspend();
+        }
+
+        std::shared_ptr<AxEvent> await_resume() { return state_ ? std::move(state_->result) : std::move(ready_); }
+
+    private:
+        EventStream* stream_;
+        std::shared_ptr<AxEvent> ready_;
+        std::shared_ptr<internal::ResumeState> state_;
+    };
+
+    EventStream(IEventBus& bus, uint64_t eventId, void* specificSender = nullptr, ResumeOn resumeOn = ResumeOn::EventLoop, size_t capacity = 1024)
+        : bus_(&bus), resumeOn_(resumeOn), shared_(std::make_shared<Shared>())
+    {
+        shared_->capacity = capacity ? capacity : 1;
+        auto shared = shared_;
+        conn_ = bus.Subscribe(eventId, [shared](const std::shared_ptr<AxEvent>& e) {
+            std::shared_ptr<internal::ResumeState> waiter;
+            {
+                std::lock_guard<std::mutex> lock(shared->mutex);
+                if (shared->waiter)
+                {
+                    waiter = std::move(shared->waiter);
+                }
+                else
+                {
+                    if (shared->queue.size() >= shared->capacity)
+                    {
+                        shared->queue.pop_front();
+                        shared->dropped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    shared->queue.push_back(e);
+                }
+            }
+            if (waiter)
+                waiter->Complete(e, false);
+        }, specificSender);
+    }
+
+    EventStream(const EventStream&) = delete;
+    EventStream& operator=(const EventStream&) = delete;
+
+    NextAwaiter Next() { return NextAwaiter(*this); }
+
+    // Events discarded because the buffer was full
+    uint64_t Dropped() const { return shared_->dropped.load(std::memory_order_relaxed); }
+
+private:
+    IEventBus* bus_;
+    ResumeOn resumeOn_;
+    std::shared_ptr<Shared> shared_;
+    EventConnectionPtr conn_;
+};
+
+} // namespace Coro
+} // namespace AxPlug
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace AxPlug
+{
+namespace internal
+{
+
+// ============================================================
+// EventSlabPool - fixed-size block pool backing pooled event payloads
+//
+// One pool per (block size, alignment). Blocks are carved out of slabs and
+// recycled through an intrusive free list; slabs are never handed back, so
+// memory is bounded by the peak number of in-flight events of that size.
+// Each module (DLL) gets its own pool instance: allocation and release both
+// go through the allocator captured in the shared_ptr control block, so a
+// block always returns to the pool it came from.
+// ============================================================
+template <size_t BlockSize, size_t BlockAlign>
+class EventSlabPool
+{
+public:
+    static EventSlabPool& Instance()
+    {
+        // Intentionally leaked: payloads may be released during static destruction (SIOF guard)
+        static EventSlabPool* pool = new EventSlabPool();
+        return *pool;
+    }
+
+    void* Allocate()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!freeList_)
+            Grow();
+        FreeBlock* block = freeList_;
+        freeList_ = block->next;
+        return block;
+    }
+
+    void Deallocate(void* p) noexcept
+    {
+        auto* block = static_cast<FreeBlock*>(p);
+        std::lock_guard<std::mutex> lock(mutex_);
+        block->next = freeList_;
+        freeList_ = block;
+    }
+
+private:
+    union FreeBlock
+    {
+        FreeBlock* next;
+        alignas(BlockAlign) unsigned char storage[BlockSize];
+    };
+
+    static constexpr size_t SLAB_BLOCKS = 64;
+
+    // Caller holds mutex_
+    void Grow()
+    {
+        auto* slab = static_cast<FreeBlock*>(::operator new(sizeof(FreeBlock) * SLAB_BLOCKS, std::align_val_t(alignof(FreeBlock))));
+        for (size_t i = 0; i < SLAB_BLOCKS; ++i)
+        {
+            slab[i].next = freeList_;
+            freeList_ = &slab[i];
+        }
+    }
+
+    FreeBlock* freeList_ = nullptr;
+    std::mutex mutex_;
+};
+
+// ============================================================
+// EventPoolAllocator - std allocator routing single-object allocations
+// (the allocate_shared control block + payload) into EventSlabPool.
+// The refcount lives inside the pooled block, next to the payload.
+// ============================================================
+template <typename T>
+class EventPoolAllocator
+{
+public:
+    using value_type = T;
+
+    EventPoolAllocator() noexcept = default;
+    template <typename U>
+    EventPoolAllocator(const EventPoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        if (n != 1)
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        return static_cast<T*>(EventSlabPool<sizeof(T), alignof(T)>::Instance().Allocate());
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        if (n != 1)
+        {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+            return;
+        }
+        EventSlabPool<sizeof(T), alignof(T)>::Instance().Deallocate(p);
+    }
+
+    template <typename U>
+    bool operator==(const EventPoolAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const EventPoolAllocator<U>&) const noexcept { return false; }
+};
+
+} // namespace internal
+} // namespace AxPlug
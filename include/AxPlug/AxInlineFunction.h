@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace AxPlug
+{
+
+// ============================================================
+// InlineFunction - move-only callable with a fixed small buffer
+//
+// Callables up to Capacity bytes (and nothrow-movable) live inside the
+// object itself, so storing and invoking them touches no heap. Larger
+// callables still work but are boxed on the heap once, at construction.
+// Calling an empty InlineFunction throws std::bad_function_call.
+// ============================================================
+template <typename Signature, size_t Capacity = 64>
+class InlineFunction;
+
+template <typename R, typename... Args, size_t Capacity>
+class InlineFunction<R(Args...), Capacity>
+{
+public:
+    // Whether F is stored in the inline buffer (no heap allocation)
+    template <typename F>
+    static constexpr bool StoresInline = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept {}
+
+    template <typename F, typename D = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<D, InlineFunction> && std::is_invocable_r_v<R, D&, Args...>>>
+    InlineFunction(F&& f)
+    {
+        if (IsNull(f))
+            return;
+        if constexpr (StoresInline<D>)
+        {
+            ::new (static_cast<void*>(&storage_)) D(std::forward<F>(f));
+            invoke_ = &InvokeInline<D>;
+            manage_ = &ManageInline<D>;
+        }
+        else
+        {
+            ::new (static_cast<void*>(&storage_)) D*(new D(std::forward<F>(f)));
+            invoke_ = &InvokeBoxed<D>;
+            manage_ = &ManageBoxed<D>;
+        }
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction& operator=(std::nullptr_t) noexcept
+    {
+        Reset();
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction()
+    {
+        Reset();
+    }
+
+    explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+    R operator()(Args... args) const
+    {
+        if (!invoke_)
+            throw std::bad_function_call();
+        return invoke_(const_cast<Storage*>(&storage_), std::forward<Args>(args)...);
+    }
+
+private:
+    using Storage = std::aligned_storage_t<(Capacity < sizeof(void*) ? sizeof(void*) : Capacity), alignof(std::max_align_t)>;
+    enum class Op { Move, Destroy };
+    using InvokeFn = R (*)(Storage*, Args&&...);
+    using ManageFn = void (*)(Op, Storage*, Storage*) noexcept;
+
+    template <typename F>
+    static bool IsNull(const F& f) noexcept
+    {
+        if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+            return f == nullptr;
+        else if constexpr (IsStdFunction<F>::value)
+            return !f;
+        else
+            return false;
+    }
+
+    template <typename T> struct IsStdFunction : std::false_type {};
+    template <typename S> struct IsStdFunction<std::function<S>> : std::true_type {};
+
+    template <typename F>
+    static R InvokeInline(Storage* s, Args&&... args)
+    {
+        return std::invoke(*std::launder(reinterpret_cast<F*>(s)), std::forward<Args>(args)...);
+    }
+
+    template <typename F>
+    static void ManageInline(Op op, Storage* src, Storage* dst) noexcept
+    {
+        F* f = std::launder(reinterpret_cast<F*>(src));
+        if (op == Op::Move)
+            ::new (static_cast<void*>(dst)) F(std::move(*f));
+        f->~F();
+    }
+
+    template <typename F>
+    static R InvokeBoxed(Storage* s, Args&&... args)
+    {
+        return std::invoke(**std::launder(reinterpret_cast<F**>(s)), std::forward<Args>(args)...);
+    }
+
+    template <typename F>
+    static void ManageBoxed(Op op, Storage* src, Storage* dst) noexcept
+    {
+        F* f = *std::launder(reinterpret_cast<F**>(src));
+        if (op == Op::Move)
+            ::new (static_cast<void*>(dst)) F*(f);
+        else
+            delete f;
+    }
+
+    void MoveFrom(InlineFunction& other) noexcept
+    {
+        if (!other.invoke_)
+            return;
+        other.manage_(Op::Move, &other.storage_, &storage_);
+        invoke_ = other.invoke_;
+        manage_ = other.manage_;
+        other.invoke_ = nullptr;
+        other.manage_ = nullptr;
+    }
+
+    void Reset() noexcept
+    {
+        if (!manage_)
+            return;
+        manage_(Op::Destroy, &storage_, nullptr);
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    Storage storage_;
+    InvokeFn invoke_ = nullptr;
+    ManageFn manage_ = nullptr;
+};
+
+} // namespace AxPlug
@@ -2,6 +2,7 @@
 
 #include "AxException.h"
 #include "AxEventBus.h"
+#include "AxBufferEvent.h"
 #include "core/INetworkEventBus.h"
 #include "AxPluginExport.h"
 #include "AxAutoRegister.h"
@@ -9,6 +10,7 @@
 #include "AxProfiler.h"
 #include "IAxObject.h"
 #include <cstring>
+#include <vector>
 
 
 #ifdef _WIN32
@@ -342,16 +344,131 @@ inline void SetExceptionHandler(ExceptionHandler handler) {
   if (bus) bus->SetExceptionHandler(std::move(handler));
 }
 
+// Demote callbacks slower than `budget` on `strikes` consecutive deliveries to their own worker (0 = off)
+inline void SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) bus->SetSlowSubscriberPolicy(budget, strikes);
+}
+
 // Publish an event with compile-time hash ID
-inline void Publish(uint64_t eventId, std::shared_ptr<AxEvent> payload, DispatchMode mode = DispatchMode::DirectCall) {
+inline void Publish(uint64_t eventId, std::shared_ptr<AxEvent> payload, DispatchMode mode = DispatchMode::DirectCall, EventPriority priority = EventPriority::Normal) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) bus->Publish(eventId, std::move(payload), mode, priority);
+}
+
+// Publish a batch of events under one eventId (one snapshot / one wakeup per batch)
+inline void PublishBatch(uint64_t eventId, const std::vector<std::shared_ptr<AxEvent>> &payloads, DispatchMode mode = DispatchMode::DirectCall, EventPriority priority = EventPriority::Normal) {
+  auto *bus = Ax_GetEventBus();
+  if (bus && !payloads.empty()) bus->PublishBatch(eventId, payloads.data(), payloads.size(), mode, priority);
+}
+
+// Publish a pooled event: constructs T(args...) via MakeEvent<T> and dispatches synchronously.
+// Use Publish(eventId, MakeEvent<T>(...), mode) for other dispatch modes.
+template <typename T, typename... Args>
+inline void Publish(uint64_t eventId, Args&&... args) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) bus->Publish(eventId, MakeEvent<T>(std::forward<Args>(args)...), DispatchMode::DirectCall);
+}
+
+// Publish once after `delay`; keep the returned handle alive (releasing it cancels)
+inline EventConnectionPtr PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxEvent> payload, EventPriority priority = EventPriority::Normal) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->PublishAfter(delay, eventId, std::move(payload), priority);
+  return nullptr;
+}
+
+// Publish every `period` until the returned handle is disconnected or released
+inline EventConnectionPtr PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxEvent> payload, EventPriority priority = EventPriority::Normal) {
   auto *bus = Ax_GetEventBus();
-  if (bus) bus->Publish(eventId, std::move(payload), mode);
+  if (bus) return bus->PublishEvery(period, eventId, std::move(payload), priority);
+  return nullptr;
 }
 
 // Subscribe to an event with compile-time hash ID
-inline EventConnectionPtr Subscribe(uint64_t eventId, EventCallback callback, void *specificSender = nullptr) {
+inline EventConnectionPtr Subscribe(uint64_t eventId, EventHandler handler, void *specificSender = nullptr) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->Subscribe(eventId, std::move(handler), specificSender);
+  return nullptr;
+}
+
+// Subscribe many handlers in one call; one handle per request, in order
+inline std::vector<EventConnectionPtr> SubscribeBulk(std::vector<SubscriptionRequest> requests) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->SubscribeBulk(std::move(requests));
+  return {};
+}
+
+// Subscribe with subscriber-thread delivery: callbacks run when the owning thread drains `mailbox`
+inline EventConnectionPtr SubscribeOn(uint64_t eventId, EventMailboxPtr mailbox, EventHandler handler, void *specificSender = nullptr) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->SubscribeOn(eventId, std::move(mailbox), std::move(handler), specificSender);
+  return nullptr;
+}
+
+// Publish a request and wait on the returned future for the reply (nullptr on timeout)
+inline std::future<std::shared_ptr<AxEvent>> Request(uint64_t eventId, std::shared_ptr<AxEvent> payload, std::chrono::milliseconds timeout, DispatchMode mode = DispatchMode::DirectCall) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->Request(eventId, std::move(payload), timeout, mode);
+  std::promise<std::shared_ptr<AxEvent>> none;
+  none.set_value(nullptr);
+  return none.get_future();
+}
+
+// Publish a request; `onReply` runs once with the reply, or nullptr on timeout
+inline uint64_t RequestAsync(uint64_t eventId, std::shared_ptr<AxEvent> payload, std::chrono::milliseconds timeout, ReplyHandler onReply, DispatchMode mode = DispatchMode::DirectCall) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->RequestAsync(eventId, std::move(payload), timeout, std::move(onReply), mode);
+  if (onReply) onReply(nullptr);
+  return 0;
+}
+
+// Answer a request received in a subscriber
+inline bool Reply(const AxEvent &request, std::shared_ptr<AxEvent> reply) {
+  auto *bus = Ax_GetEventBus();
+  return bus && bus->Reply(request, std::move(reply));
+}
+
+// Run an event's DirectCall subscribers in parallel (Publish still returns after all of them)
+inline bool SetParallelDispatch(uint64_t eventId, bool enabled = true) {
+  auto *bus = Ax_GetEventBus();
+  return bus && bus->SetParallelDispatch(eventId, enabled);
+}
+
+// Keep an event's last payload and deliver it to late subscribers
+inline bool SetSticky(uint64_t eventId, bool enabled = true) {
+  auto *bus = Ax_GetEventBus();
+  return bus && bus->SetSticky(eventId, enabled);
+}
+
+// Start recording to a memory-mapped journal; opt eventIds in with JournalEvent
+inline bool OpenJournal(const char *path, size_t capacityBytes) {
+  auto *bus = Ax_GetEventBus();
+  return bus && bus->OpenJournal(path, capacityBytes);
+}
+
+// Journal an INetworkableEvent type; the factory rebuilds payloads on replay
+inline bool JournalEvent(uint64_t eventId, JournalEventFactory factory) {
+  auto *bus = Ax_GetEventBus();
+  return bus && bus->JournalEvent(eventId, std::move(factory));
+}
+
+// Re-publish journaled events stamped within [from, to]
+inline size_t ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, DispatchMode mode = DispatchMode::DirectCall) {
+  auto *bus = Ax_GetEventBus();
+  return bus ? bus->ReplayJournal(from, to, mode) : 0;
+}
+
+// Declare a hierarchical topic name ("A::B::C") so SubscribePattern can match it; returns its event ID
+inline uint64_t RegisterTopic(const char *name) {
+  auto *bus = Ax_GetEventBus();
+  if (bus) return bus->RegisterTopic(name);
+  return HashEventId(name);
+}
+
+// Subscribe to all registered topics under a prefix, e.g. "Camera::*"
+inline EventConnectionPtr SubscribePattern(const char *pattern, EventHandler handler, void *specificSender = nullptr) {
   auto *bus = Ax_GetEventBus();
-  if (bus) return bus->Subscribe(eventId, std::move(callback), specificSender);
+  if (bus) return bus->SubscribePattern(pattern, std::move(handler), specificSender);
   return nullptr;
 }
 
@@ -2,6 +2,7 @@
 
 #include "AxPlug/AxEventBus.h"
 #include "AxPlug/IAxObject.h"
+#include <chrono>
 #include <functional>
 
 namespace AxPlug
@@ -10,6 +11,28 @@ namespace AxPlug
 // Factory function to create an empty INetworkableEvent for deserialization
 using NetworkEventFactory = std::function<std::shared_ptr<INetworkableEvent>()>;
 
+// Transport counters of INetworkEventBus (cumulative since construction)
+struct NetworkTransportStats
+{
+    uint64_t fragmentedSent = 0;     // events too large for one datagram, sent as fragments
+    uint64_t fragmentsSent = 0;
+    uint64_t fragmentsReceived = 0;
+    uint64_t reassembled = 0;        // fragmented events completed and published
+    uint64_t reassemblyTimeouts = 0; // partial events expired before all fragments arrived
+    uint64_t reassemblyDrops = 0;    // partial events evicted (table / memory bound) and malformed fragments
+    uint64_t oversizeDrops = 0;      // outgoing events larger than the fragmentation limit
+    uint64_t batchesSent = 0;        // datagrams carrying coalesced small events
+    uint64_t batchedEvents = 0;      // events sent inside those datagrams
+    uint64_t naksSent = 0;           // retransmit requests for gaps in a sender's sequence
+    uint64_t retransmits = 0;        // datagrams resent in answer to other nodes' NAKs
+    uint64_t datagramsRecovered = 0; // gap datagrams that arrived late or by retransmit
+    uint64_t datagramsLost = 0;      // gap datagrams given up on (timeout / no longer retained)
+    uint64_t duplicatesDropped = 0;  // sequenced datagrams already delivered
+    uint64_t throttled = 0;          // events not broadcast because of their rate limit
+    uint64_t uninterestedSkipped = 0; // events not broadcast because no peer advertised their eventId
+    uint64_t interestAdverts = 0;    // datagrams advertising this node's subscribed eventIds
+};
+
 // INetworkEventBus - Plugin interface that extends IAxObject for plugin lifecycle
 // and proxies IEventBus for transparent event bus replacement ("夺舍" takeover).
 //
@@ -38,6 +61,31 @@ public:
 
     // Get the 64-bit node ID of this process (for cross-node sender identity)
     virtual uint64_t GetNodeId() const = 0;
+
+    // Fragmentation / reassembly counters
+    virtual NetworkTransportStats GetTransportStats() const = 0;
+
+    // Coalesce small events into one datagram of up to `datagramBytes`, sent when
+    // full or `maxDelay` after its first event. 0 bytes turns batching off
+    // (default). Every node on the group must understand batched datagrams.
+    virtual void SetBatching(size_t datagramBytes, std::chrono::microseconds maxDelay) = 0;
+
+    // Number outgoing datagrams and keep the most recent `retransmitBytes` of them
+    // so receivers can NAK what they missed; 0 turns it off (default). Receivers
+    // need no setup. Losses that cannot be repaired count as datagramsLost.
+    virtual void SetReliableDelivery(size_t retransmitBytes) = 0;
+
+    // Token-bucket limit on broadcasts of `eventId`: `eventsPerSecond` sustained,
+    // up to `burst` back to back. Rate <= 0 removes the limit. Events without a
+    // setting get 100/s with a burst of 100. Throttled events are still
+    // delivered locally. False if no more event IDs can be tracked.
+    virtual bool SetRateLimit(uint64_t eventId, double eventsPerSecond, uint32_t burst) = 0;
+
+    // Every node advertises the registered eventIds it has local subscribers
+    // for. With filtering on, an event no peer advertised is neither
+    // serialized nor sent (still delivered locally). Off by default: nodes
+    // that predate the adverts would otherwise stop receiving.
+    virtual void SetInterestFiltering(bool enabled) = 0;
 };
 
 } // namespace AxPlug
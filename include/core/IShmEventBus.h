@@ -0,0 +1,45 @@
+#pragma once
+
+#include "AxPlug/AxEventBus.h"
+#include "AxPlug/IAxObject.h"
+#include "core/INetworkEventBus.h"
+
+namespace AxPlug
+{
+
+// IShmEventBus - same-host IPC transport over a named shared-memory segment.
+// Takes over the global bus exactly like INetworkEventBus: local dispatch is
+// unchanged, INetworkableEvent payloads are additionally copied into the
+// inbox ring of every other process attached to the same segment.
+//
+// Usage:
+//   auto shmBus = AxPlug::GetService<IShmEventBus>();
+//   shmBus->RegisterNetworkableEvent(MY_EVENT_ID, []() { return std::make_shared<MyEvent>(); });
+//   shmBus->StartShm("AxPlugEvents", 1 << 20);
+class IShmEventBus : public IAxObject
+{
+    AX_INTERFACE(IShmEventBus)
+public:
+    // Attach to (or create) the named segment with an inbox of `ringBytes` per process.
+    // All processes must use the same ringBytes for a given segment name.
+    virtual bool StartShm(const char* segmentName, size_t ringBytes) = 0;
+
+    // Detach from the segment and stop the receiver thread
+    virtual void StopShm() = 0;
+
+    virtual bool IsShmActive() const = 0;
+
+    // Register a factory for a networkable event type (required for deserialization)
+    virtual void RegisterNetworkableEvent(uint64_t eventId, NetworkEventFactory factory) = 0;
+
+    // Get the IEventBus interface pointer (for SetEventBus takeover)
+    virtual IEventBus* AsEventBus() = 0;
+
+    // 64-bit node ID of this process on the segment
+    virtual uint64_t GetNodeId() const = 0;
+
+    // Events not delivered because a peer's inbox was full
+    virtual uint64_t GetDroppedCount() const = 0;
+};
+
+} // namespace AxPlug
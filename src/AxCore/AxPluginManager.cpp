@@ -61,7 +61,7 @@ void AxPluginManager::Init(const char *mainAppDir) {
   // Phase 3: Publish system init event
   auto* bus = GetEventBus();
   if (bus) {
-    auto ev = std::make_shared<AxPlug::SystemInitEvent>();
+    auto ev = AxPlug::MakeEvent<AxPlug::SystemInitEvent>();
     ev->pluginDir = mainAppDir ? mainAppDir : "";
     bus->Publish(AxPlug::EVENT_SYSTEM_INIT, std::move(ev), AxPlug::DispatchMode::DirectCall);
   }
@@ -230,7 +230,7 @@ void AxPluginManager::LoadOnePlugin(const std::string &path) {
   auto* bus = GetEventBus();
   if (bus) {
     for (const auto& pe : pendingEvents) {
-      auto ev = std::make_shared<AxPlug::PluginLoadedEvent>();
+      auto ev = AxPlug::MakeEvent<AxPlug::PluginLoadedEvent>();
       ev->pluginName = pe.name;
       bus->Publish(AxPlug::EVENT_PLUGIN_LOADED, std::move(ev), AxPlug::DispatchMode::DirectCall);
     }
@@ -642,7 +642,7 @@ void AxPluginManager::ReleaseAllSingletons() {
   // Publish shutdown event before tearing down
   auto* bus = GetEventBus();
   if (bus) {
-    auto ev = std::make_shared<AxPlug::SystemShutdownEvent>();
+    auto ev = AxPlug::MakeEvent<AxPlug::SystemShutdownEvent>();
     bus->Publish(AxPlug::EVENT_SYSTEM_SHUTDOWN, std::move(ev), AxPlug::DispatchMode::DirectCall);
   }
 
@@ -1,11 +1,53 @@
 #include "DefaultEventBus.h"
+#include "AxPlug/AxBufferEvent.h"
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+
+namespace
+{
+// Hash a topic name and collect the hashes of its ancestors ("", "A", "A::B" for
+// "A::B::C"). FNV-1a is incremental, so each prefix hash is the running state
+// at a "::" separator and the result equals HashEventId(name).
+uint64_t HashTopic(const char* name, std::vector<uint64_t>& prefixes)
+{
+    uint64_t hash = AxPlug::AX_EVENT_FNV_OFFSET;
+    prefixes.push_back(hash);
+    for (const char* p = name; *p; ++p)
+    {
+        if (p != name && p[0] == ':' && p[1] == ':')
+            prefixes.push_back(hash);
+        hash = (hash ^ static_cast<uint64_t>(*p)) * AxPlug::AX_EVENT_FNV_PRIME;
+    }
+    return hash;
+}
+
+// "A::B::*" -> hash of "A::B", "*" -> hash of "". False unless '*' is the whole last level.
+bool ParseTopicPattern(const char* pattern, uint64_t& prefix)
+{
+    size_t len = strlen(pattern);
+    const char* star = strchr(pattern, '*');
+    if (star == nullptr || star != pattern + len - 1)
+        return false;
+    size_t prefixLen = 0;
+    if (len > 1)
+    {
+        if (len < 4 || pattern[len - 2] != ':' || pattern[len - 3] != ':')
+            return false;
+        prefixLen = len - 3;
+    }
+    prefix = AxPlug::AX_EVENT_FNV_OFFSET;
+    for (size_t i = 0; i < prefixLen; ++i)
+        prefix = (prefix ^ static_cast<uint64_t>(pattern[i])) * AxPlug::AX_EVENT_FNV_PRIME;
+    return true;
+}
+} // namespace
 
 DefaultEventBus::DefaultEventBus()
 {
     running_.store(true, std::memory_order_release);
     eventLoopThread_ = std::thread(&DefaultEventBus::EventLoopThread, this);
+    sweepTask_ = ScheduleTask(std::chrono::milliseconds(SWEEP_INTERVAL_MS), std::chrono::milliseconds(SWEEP_INTERVAL_MS), [this]() { SweepExpired(); });
 }
 
 void DefaultEventBus::SetExceptionHandler(AxPlug::ExceptionHandler handler)
@@ -52,116 +94,1013 @@ void DefaultEventBus::Shutdown()
     queueCV_.notify_all();
     if (eventLoopThread_.joinable())
         eventLoopThread_.join();
+    dispatchPool_.Stop();
+
+    // Quarantine workers finish their current callback and stop draining. The
+    // mailboxes stay allocated: subscribers still point at them until destruction.
+    {
+        std::lock_guard<std::mutex> lock(quarantineMutex_);
+        quarantineRunning_.store(false, std::memory_order_release);
+    }
+    for (auto& worker : quarantineWorkers_)
+    {
+        if (worker->thread.joinable())
+            worker->thread.join();
+    }
+
+    // Timeouts can no longer fire: fail whatever is still waiting for a reply
+    std::unordered_map<uint64_t, PendingRequest> pending;
+    {
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        pending.swap(pendingRequests_);
+    }
+    for (auto& kv : pending)
+    {
+        try { kv.second.onReply(nullptr); } catch (const std::exception& e) { ReportException(e); } catch (...) { ReportUnknownException(); }
+    }
 }
 
 // ============================================================
 // Publish
 // ============================================================
-void DefaultEventBus::Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode)
+void DefaultEventBus::Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
 {
     AX_PROFILE_SCOPE("EventBus::Publish");
+    if (journal_.HasTracked())
+        RecordJournal(eventId, &payload, 1);
     if (mode == AxPlug::DispatchMode::DirectCall)
     {
-        DispatchDirect(eventId, std::move(payload));
+        DispatchDirect(eventId, payload);
     }
     else
     {
+        // Mailbox subscribers get the event now, on this thread (single handoff)
+        bool mailboxesDelivered = false;
+        uint64_t visibleSeq = 0;
+        if (mailboxSubscriptions_.load(std::memory_order_relaxed) != 0)
+        {
+            if (!PostToMailboxes(eventId, &payload, 1, visibleSeq))
+                return;
+            mailboxesDelivered = true;
+        }
+
         // Queued: push into MPSC queue with enqueue timestamp for latency tracking
+        Enqueue({ eventId, std::move(payload), {}, {}, mailboxesDelivered, priority, visibleSeq });
+    }
+}
+
+// ============================================================
+// PublishBatch - one snapshot / one profile scope / one wakeup per batch
+// ============================================================
+void DefaultEventBus::PublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    if (!payloads || count == 0)
+        return;
+
+    AX_PROFILE_SCOPE("EventBus::PublishBatch");
+    if (journal_.HasTracked())
+        RecordJournal(eventId, payloads, count);
+    if (mode == AxPlug::DispatchMode::DirectCall)
+    {
+        DispatchBatch(eventId, payloads, count);
+    }
+    else
+    {
+        bool mailboxesDelivered = false;
+        uint64_t visibleSeq = 0;
+        if (mailboxSubscriptions_.load(std::memory_order_relaxed) != 0)
         {
-            std::lock_guard<std::mutex> lock(queueMutex_);
-            asyncQueue_.push({ eventId, std::move(payload), std::chrono::steady_clock::now() });
+            if (!PostToMailboxes(eventId, payloads, count, visibleSeq))
+                return;
+            mailboxesDelivered = true;
         }
-        queueCV_.notify_one();
+
+        // Copy payload refs outside the lock, then enqueue the whole batch as one entry
+        Enqueue({ eventId, nullptr, {}, std::vector<std::shared_ptr<AxPlug::AxEvent>>(payloads, payloads + count), mailboxesDelivered, priority, visibleSeq });
+    }
+}
+
+// ============================================================
+// Event journal - record on the publisher thread, replay through Publish
+// ============================================================
+namespace
+{
+thread_local bool t_replayingJournal = false;
+
+int64_t JournalNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+void DefaultEventBus::RecordJournal(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count)
+{
+    if (t_replayingJournal || !journal_.IsTracked(eventId))
+        return;
+    int64_t now = JournalNow();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!payloads[i])
+            continue;
+        const uint64_t sender = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(payloads[i]->sender));
+        if (auto* buffer = dynamic_cast<const AxPlug::AxBufferEvent*>(payloads[i].get()))
+        {
+            journal_.Append(eventId, sender, now, reinterpret_cast<const char*>(buffer->bytes.data()), buffer->bytes.size());
+            continue;
+        }
+        auto* networkable = dynamic_cast<const AxPlug::INetworkableEvent*>(payloads[i].get());
+        if (!networkable)
+            continue;
+        thread_local std::vector<uint8_t> scratch;
+        size_t size = 0;
+        if (networkable->SerializeInto(scratch, size))
+        {
+            journal_.Append(eventId, sender, now, reinterpret_cast<const char*>(scratch.data()), size);
+            if (scratch.capacity() > JOURNAL_SCRATCH_KEEP_BYTES)
+                std::vector<uint8_t>().swap(scratch);
+            continue;
+        }
+        std::string bytes = networkable->Serialize();
+        journal_.Append(eventId, sender, now, bytes.data(), bytes.size());
+    }
+}
+
+bool DefaultEventBus::OpenJournal(const char* path, size_t capacityBytes)
+{
+    return journal_.Open(path, capacityBytes);
+}
+
+void DefaultEventBus::CloseJournal()
+{
+    journal_.Close();
+}
+
+bool DefaultEventBus::JournalEvent(uint64_t eventId, AxPlug::JournalEventFactory factory)
+{
+    if (!factory)
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(journalMutex_);
+        journalFactories_[eventId] = std::move(factory);
+    }
+    if (!journal_.Track(eventId))
+    {
+        fprintf(stderr, "[EventBus] Journal can track at most %zu eventIds; 0x%llx not recorded.\n", EventJournal::MAX_TRACKED_EVENTS, static_cast<unsigned long long>(eventId));
+        return false;
+    }
+    return true;
+}
+
+size_t DefaultEventBus::ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, AxPlug::DispatchMode mode)
+{
+    std::unordered_map<uint64_t, AxPlug::JournalEventFactory> factories;
+    {
+        std::lock_guard<std::mutex> lock(journalMutex_);
+        factories = journalFactories_;
     }
+
+    auto toNs = [](std::chrono::system_clock::time_point t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    };
+
+    // Replayed events go through Publish but must not be journaled again
+    struct ReplayScope
+    {
+        ReplayScope() { t_replayingJournal = true; }
+        ~ReplayScope() { t_replayingJournal = false; }
+    } scope;
+
+    size_t published = 0;
+    journal_.Read(toNs(from), toNs(to), [&](const EventJournal::RecordView& rec) {
+        auto it = factories.find(rec.eventId);
+        if (it == factories.end())
+            return;
+        std::shared_ptr<AxPlug::INetworkableEvent> evt;
+        try {
+            evt = it->second();
+            if (!evt)
+                return;
+            evt->DeserializeFrom(reinterpret_cast<const uint8_t*>(rec.data), rec.size);
+        } catch (const std::exception& e) {
+            ReportException(e);
+            return;
+        } catch (...) {
+            ReportUnknownException();
+            return;
+        }
+        evt->sender = reinterpret_cast<void*>(static_cast<uintptr_t>(rec.sender));
+        Publish(rec.eventId, std::move(evt), mode);
+        ++published;
+    });
+    return published;
+}
+
+// ============================================================
+// Enqueue - single lock + single wakeup per entry
+// ============================================================
+void DefaultEventBus::Enqueue(QueuedEvent evt)
+{
+    size_t lane = static_cast<size_t>(evt.priority);
+    if (lane >= PRIORITY_LANES)
+        lane = static_cast<size_t>(AxPlug::EventPriority::Normal);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        evt.enqueueTime = std::chrono::steady_clock::now();
+        asyncQueues_[lane].push(std::move(evt));
+    }
+    queueCV_.notify_one();
+}
+
+// ============================================================
+// PopNextQueued - lane scheduler (strict Critical, weighted Normal/Bulk)
+// ============================================================
+bool DefaultEventBus::PopNextQueued(QueuedEvent& out)
+{
+    auto& critical = asyncQueues_[static_cast<size_t>(AxPlug::EventPriority::Critical)];
+    auto& normal = asyncQueues_[static_cast<size_t>(AxPlug::EventPriority::Normal)];
+    auto& bulk = asyncQueues_[static_cast<size_t>(AxPlug::EventPriority::Bulk)];
+
+    std::queue<QueuedEvent>* lane = nullptr;
+    if (!critical.empty())
+    {
+        lane = &critical;
+    }
+    else if (!normal.empty() && (bulk.empty() || normalStreak_ < NORMAL_BULK_WEIGHT))
+    {
+        lane = &normal;
+        ++normalStreak_;
+    }
+    else if (!bulk.empty())
+    {
+        lane = &bulk;
+        normalStreak_ = 0;
+    }
+    else
+    {
+        return false;
+    }
+
+    out = std::move(lane->front());
+    lane->pop();
+    return true;
+}
+
+// ============================================================
+// PostToMailboxes - Queued fast path for subscriber-thread delivery
+// ============================================================
+bool DefaultEventBus::PostToMailboxes(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, uint64_t& visibleSeq)
+{
+    EventEntry* entry = nullptr;
+    SubscriberTablePtr snapshot = GetSnapshot(eventId, entry, visibleSeq, &payloads[count - 1]);
+    EventMetrics* metrics = &entry->metrics;
+    metrics->publishes.fetch_add(count, std::memory_order_relaxed);
+    if (!snapshot || snapshot->Empty())
+        return true; // keep legacy behaviour: late subscribers may still get it from the loop
+
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;
+    auto post = [&](const SubscriberPtr& sub, const std::shared_ptr<AxPlug::AxEvent>& payload) {
+        if (!sub->viaMailbox || sub->subscribeSeq > visibleSeq || !sub->connection.IsActive())
+            return;
+        auto mailbox = sub->mailbox.lock();
+        if (!mailbox)
+            sub->connection.Disconnect(); // owner dropped its inbox; let GC purge it
+        else if (mailbox->Post({ std::shared_ptr<const AxPlug::EventHandler>(sub, &sub->handler), payload, &sub->connection }))
+            ++delivered;
+        else
+            ++dropped;
+    };
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (const auto& sub : snapshot->Wildcard())
+            post(sub, payloads[i]);
+        // A null payload has no sender, so only wildcard subscribers match it
+        for (const auto& sub : snapshot->Matching(payloads[i] ? payloads[i]->sender : nullptr))
+            post(sub, payloads[i]);
+    }
+    if (delivered)
+        metrics->deliveries.fetch_add(delivered, std::memory_order_relaxed);
+    if (dropped)
+        metrics->drops.fetch_add(dropped, std::memory_order_relaxed);
+    return entry->directCount.load(std::memory_order_relaxed) != 0;
 }
 
 // ============================================================
 // Subscribe (COW write path)
 // ============================================================
-AxPlug::EventConnectionPtr DefaultEventBus::Subscribe(uint64_t eventId, AxPlug::EventCallback callback, void* specificSender)
+AxPlug::EventConnectionPtr DefaultEventBus::Subscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender)
+{
+    auto sub = std::make_shared<Subscriber>();
+    sub->handler = std::move(handler);
+    sub->specificSender = specificSender;
+    return AddSubscriber(eventId, std::move(sub));
+}
+
+// ============================================================
+// SubscribeOn - subscriber-thread delivery through an EventMailbox
+// ============================================================
+AxPlug::EventConnectionPtr DefaultEventBus::SubscribeOn(uint64_t eventId, AxPlug::EventMailboxPtr mailbox, AxPlug::EventHandler handler, void* specificSender)
 {
-    auto conn = std::make_shared<AxPlug::EventConnection>();
+    if (!mailbox || !handler)
+        return nullptr;
 
-    Subscriber sub;
-    sub.connection = conn;
-    sub.callback = std::move(callback);
-    sub.specificSender = specificSender;
+    auto sub = std::make_shared<Subscriber>();
+    sub->handler = std::move(handler);
+    sub->specificSender = specificSender;
+    sub->mailbox = mailbox;
+    sub->viaMailbox = true;
+    mailboxSubscriptions_.fetch_add(1, std::memory_order_relaxed);
+    return AddSubscriber(eventId, std::move(sub));
+}
 
+// ============================================================
+// SubscribeBulk - one lock and one table update per eventId
+// ============================================================
+std::vector<AxPlug::EventConnectionPtr> DefaultEventBus::SubscribeBulk(std::vector<AxPlug::SubscriptionRequest> requests)
+{
+    std::vector<AxPlug::EventConnectionPtr> conns(requests.size());
+    std::vector<std::pair<uint64_t, SubscriberPtr>> subs;
+    subs.reserve(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i)
+    {
+        auto sub = std::make_shared<Subscriber>();
+        sub->handler = std::move(requests[i].handler);
+        sub->specificSender = requests[i].specificSender;
+        conns[i] = AxPlug::EventConnectionPtr(&sub->connection, [sub](AxPlug::EventConnection* c) { c->Disconnect(); });
+        subs.emplace_back(requests[i].eventId, std::move(sub));
+    }
+
+    // Group by eventId (stable: per-event subscription order is kept)
+    std::stable_sort(subs.begin(), subs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<SubscriberPtr> group;
+    std::vector<StickyDelivery> sticky;
     {
         std::lock_guard<std::mutex> lock(subscriberMutex_);
-        auto it = subscriberMap_.find(eventId);
-        if (it == subscriberMap_.end())
+        for (size_t i = 0; i < subs.size();)
         {
-            // First subscriber for this event: create new list
-            auto newList = std::make_shared<std::vector<Subscriber>>();
-            newList->push_back(std::move(sub));
-            subscriberMap_[eventId] = std::move(newList);
+            uint64_t eventId = subs[i].first;
+            group.clear();
+            for (; i < subs.size() && subs[i].first == eventId; ++i)
+                group.push_back(subs[i].second);
+            EventEntry& entry = GetEntryLocked(eventId);
+            InsertLocked(entry, group.data(), group.size());
+            for (const auto& sub : group)
+                CollectStickyLocked(eventId, entry, sub, sticky);
         }
-        else
+    }
+    DeliverSticky(sticky);
+    return conns;
+}
+
+AxPlug::EventConnectionPtr DefaultEventBus::AddSubscriber(uint64_t eventId, SubscriberPtr sub)
+{
+    // Caller's handle aliases the embedded connection; releasing it disconnects
+    AxPlug::EventConnectionPtr conn(&sub->connection, [sub](AxPlug::EventConnection* c) { c->Disconnect(); });
+
+    std::vector<StickyDelivery> sticky;
+    {
+        std::lock_guard<std::mutex> lock(subscriberMutex_);
+        EventEntry& entry = GetEntryLocked(eventId);
+        InsertLocked(entry, &sub, 1);
+        CollectStickyLocked(eventId, entry, sub, sticky);
+    }
+    DeliverSticky(sticky);
+
+    return conn;
+}
+
+// ============================================================
+// Sticky events - last payload handed to new subscribers
+// ============================================================
+bool DefaultEventBus::SetSticky(uint64_t eventId, bool enabled)
+{
+    std::shared_ptr<AxPlug::AxEvent> dropped; // released outside the lock
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    EventEntry& entry = GetEntryLocked(eventId);
+    entry.sticky = enabled;
+    if (!enabled)
+        dropped = std::move(entry.lastValue);
+    return true;
+}
+
+void DefaultEventBus::CollectStickyLocked(uint64_t eventId, EventEntry& entry, const SubscriberPtr& sub, std::vector<StickyDelivery>& out)
+{
+    if (!entry.sticky || !entry.lastValue)
+        return;
+    if (sub->specificSender && sub->specificSender != entry.lastValue->sender)
+        return;
+    out.push_back({ eventId, &entry, sub, entry.lastValue });
+}
+
+void DefaultEventBus::DeliverSticky(const std::vector<StickyDelivery>& pending)
+{
+    // Entries are never erased, so the pointers stay valid outside the lock
+    for (const auto& d : pending)
+    {
+        auto start = std::chrono::steady_clock::now();
+        DeliveryResult result = DeliverOne(d.eventId, d.sub, d.payload, false, d.entry->metrics, start);
+        if (result == DeliveryResult::Delivered)
+            d.entry->metrics.deliveries.fetch_add(1, std::memory_order_relaxed);
+        else if (result == DeliveryResult::Dropped)
+            d.entry->metrics.drops.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+DefaultEventBus::EventEntry& DefaultEventBus::GetEntryLocked(uint64_t eventId)
+{
+    auto& entry = subscriberMap_[eventId];
+    if (!entry)
+        entry = std::make_unique<EventEntry>();
+    return *entry;
+}
+
+void DefaultEventBus::InsertLocked(EventEntry& entry, const SubscriberPtr* subs, size_t count)
+{
+    // Appends into arrays with spare room are published in place; a full array
+    // or a new sender bucket needs a new table, cloned once for the whole call
+    std::shared_ptr<SubscriberTable> table = entry.subscribers;
+    bool cloned = false;
+    auto writable = [&]() -> SubscriberTable& {
+        if (!cloned)
+        {
+            table = table ? std::make_shared<SubscriberTable>(*table) : std::make_shared<SubscriberTable>();
+            cloned = true;
+        }
+        return *table;
+    };
+
+    size_t direct = 0;
+    size_t purgedDirect = 0; // dead subscribers left behind by a rebuild
+    for (size_t i = 0; i < count; ++i)
+    {
+        const SubscriberPtr& sub = subs[i];
+        if (sub->subscribeSeq == 0)
+            sub->subscribeSeq = ++subscribeSeq_;
+        SubscriberArray* array = nullptr;
+        if (table)
+        {
+            if (sub->specificSender == nullptr)
+                array = table->wildcard.get();
+            else
+            {
+                auto it = table->bySender.find(sub->specificSender);
+                array = it == table->bySender.end() ? nullptr : it->second.get();
+            }
+        }
+        if (array == nullptr || array->Full())
         {
-            // COW: deep clone existing list, append, then atomic replace
-            auto newList = std::make_shared<std::vector<Subscriber>>(*it->second);
-            newList->push_back(std::move(sub));
-            it->second = std::move(newList);
+            SubscriberTable& w = writable();
+            SubscriberArrayPtr& slot = sub->specificSender == nullptr ? w.wildcard : w.bySender[sub->specificSender];
+            slot = RebuildArray(slot.get(), count - i, &purgedDirect);
+            array = slot.get();
         }
+        array->Append(sub);
+        if (!sub->viaMailbox)
+            ++direct;
     }
 
+    if (cloned)
+        entry.subscribers = std::move(table);
+    if (direct != purgedDirect)
+        entry.directCount.store(entry.directCount.load(std::memory_order_relaxed) + direct - purgedDirect, std::memory_order_relaxed);
+}
+
+DefaultEventBus::SubscriberArrayPtr DefaultEventBus::RebuildArray(const SubscriberArray* old, size_t extra, size_t* purgedDirect)
+{
+    size_t live = 0;
+    if (old)
+    {
+        for (const auto& sub : old->Items())
+        {
+            if (sub->connection.IsActive())
+                ++live;
+            else if (purgedDirect && !sub->viaMailbox)
+                ++*purgedDirect;
+        }
+    }
+    // Double on growth so appends stay O(1) amortised
+    size_t capacity = (std::max)({ MIN_ARRAY_CAPACITY, live + extra, old ? old->Capacity() * 2 : size_t(0) });
+    if (old && live * 2 < old->Capacity())
+        capacity = (std::max)(MIN_ARRAY_CAPACITY, (live + extra) * 2); // mostly dead: shrink instead
+    auto array = std::make_shared<SubscriberArray>(capacity);
+    if (old)
+    {
+        for (const auto& sub : old->Items())
+        {
+            if (sub->connection.IsActive())
+                array->Append(sub);
+        }
+    }
+    return array;
+}
+
+// ============================================================
+// Hierarchical topics - patterns are resolved at subscribe/register
+// time, so the publish path only ever sees plain subscriber tables
+// ============================================================
+uint64_t DefaultEventBus::RegisterTopic(const char* name)
+{
+    std::vector<uint64_t> prefixes;
+    uint64_t eventId = HashTopic(name, prefixes);
+
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    EventEntry& entry = GetEntryLocked(eventId);
+    if (entry.isTopic)
+        return eventId;
+    entry.isTopic = true;
+    entry.topicPrefixes = std::move(prefixes);
+
+    // Attach existing pattern subscribers of every ancestor
+    std::vector<SubscriberPtr> matched;
+    for (uint64_t prefix : entry.topicPrefixes)
+    {
+        auto it = patternSubscribers_.find(prefix);
+        if (it == patternSubscribers_.end())
+            continue;
+        auto& bucket = it->second;
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [](const SubscriberPtr& s) { return !s->connection.IsActive(); }), bucket.end());
+        matched.insert(matched.end(), bucket.begin(), bucket.end());
+    }
+    if (!matched.empty())
+        InsertLocked(entry, matched.data(), matched.size());
+    return eventId;
+}
+
+AxPlug::EventConnectionPtr DefaultEventBus::SubscribePattern(const char* pattern, AxPlug::EventHandler handler, void* specificSender)
+{
+    if (strchr(pattern, '*') == nullptr)
+        return Subscribe(AxPlug::HashEventId(pattern), std::move(handler), specificSender);
+
+    uint64_t prefix = 0;
+    if (!ParseTopicPattern(pattern, prefix))
+    {
+        fprintf(stderr, "[EventBus] Invalid topic pattern '%s' (expected \"Prefix::*\" or \"*\").\n", pattern);
+        return nullptr;
+    }
+
+    auto sub = std::make_shared<Subscriber>();
+    sub->handler = std::move(handler);
+    sub->specificSender = specificSender;
+    AxPlug::EventConnectionPtr conn(&sub->connection, [sub](AxPlug::EventConnection* c) { c->Disconnect(); });
+
+    std::vector<StickyDelivery> sticky;
+    {
+        std::lock_guard<std::mutex> lock(subscriberMutex_);
+        auto& bucket = patternSubscribers_[prefix];
+        bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [](const SubscriberPtr& s) { return !s->connection.IsActive(); }), bucket.end());
+        bucket.push_back(sub);
+
+        // Attach to every topic already registered under the prefix
+        for (auto& kv : subscriberMap_)
+        {
+            EventEntry& entry = *kv.second;
+            if (entry.isTopic && std::find(entry.topicPrefixes.begin(), entry.topicPrefixes.end(), prefix) != entry.topicPrefixes.end())
+            {
+                InsertLocked(entry, &sub, 1);
+                CollectStickyLocked(kv.first, entry, sub, sticky);
+            }
+        }
+    }
+    DeliverSticky(sticky);
     return conn;
 }
 
+// ============================================================
+// ScheduleTask - hand a timer to the event loop's wheel
+// ============================================================
+AxPlug::EventConnectionPtr DefaultEventBus::ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, AxPlug::InlineFunction<void()> task)
+{
+    if (!task)
+        return nullptr;
+
+    auto timer = std::make_shared<EventTimerWheel::Task>();
+    timer->fn = std::move(task);
+    timer->period = EventTimerWheel::ToTicks(period);
+    auto due = EventTimerWheel::Clock::now() + delay;
+
+    // Same handle scheme as subscriptions: releasing the handle cancels
+    AxPlug::EventConnectionPtr conn(&timer->connection, [timer](AxPlug::EventConnection* c) { c->Disconnect(); });
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        pendingTimers_.emplace_back(std::move(timer), due);
+        // The loop picks pending timers up whenever it wakes; only a timer due
+        // before its planned wakeup needs a notify (request timeouts stay syscall-free)
+        wake = due < loopWakeAt_;
+    }
+    if (wake)
+        queueCV_.notify_one();
+    return conn;
+}
+
+AxPlug::EventConnectionPtr DefaultEventBus::PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority)
+{
+    return ScheduleTask(delay, std::chrono::milliseconds(0), [this, eventId, payload = std::move(payload), priority]() mutable {
+        Publish(eventId, std::move(payload), AxPlug::DispatchMode::Queued, priority);
+    });
+}
+
+AxPlug::EventConnectionPtr DefaultEventBus::PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority)
+{
+    if (period.count() <= 0)
+        period = std::chrono::milliseconds(1);
+    return ScheduleTask(period, period, [this, eventId, payload = std::move(payload), priority]() {
+        Publish(eventId, payload, AxPlug::DispatchMode::Queued, priority);
+    });
+}
+
+// ============================================================
+// Request / Reply - correlation table; replies complete the waiter directly
+// ============================================================
+uint64_t DefaultEventBus::RequestAsync(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, std::chrono::milliseconds timeout, AxPlug::ReplyHandler onReply, AxPlug::DispatchMode mode)
+{
+    if (!onReply)
+        return 0;
+    if (!payload)
+    {
+        onReply(nullptr);
+        return 0;
+    }
+
+    const uint64_t correlationId = nextCorrelationId_.fetch_add(1, std::memory_order_relaxed);
+    {
+        // Registered before publishing, so even a synchronous Reply finds it.
+        // running_ is checked under the lock Shutdown takes to fail leftovers.
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        if (running_.load(std::memory_order_acquire))
+            pendingRequests_[correlationId].onReply = std::move(onReply);
+    }
+    if (onReply) // bus already shut down: nobody could time it out
+    {
+        onReply(nullptr);
+        return 0;
+    }
+
+    // ScheduleTask takes queueMutex_, which the event loop holds while a Reply
+    // handler takes requestMutex_: schedule outside requestMutex_, then attach.
+    // If the request already completed, dropping the connection cancels the timer.
+    auto timeoutTask = ScheduleTask(timeout, std::chrono::milliseconds(0), [this, correlationId]() { CompleteRequest(correlationId, nullptr); });
+    {
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        auto it = pendingRequests_.find(correlationId);
+        if (it != pendingRequests_.end())
+            it->second.timeout = std::move(timeoutTask);
+    }
+
+    payload->correlationId = correlationId;
+
+    Publish(eventId, std::move(payload), mode);
+    return correlationId;
+}
+
+bool DefaultEventBus::Reply(const AxPlug::AxEvent& request, std::shared_ptr<AxPlug::AxEvent> reply)
+{
+    if (request.correlationId == 0 || !reply)
+        return false;
+    reply->correlationId = request.correlationId;
+    return CompleteRequest(request.correlationId, std::move(reply));
+}
+
+bool DefaultEventBus::CompleteRequest(uint64_t correlationId, std::shared_ptr<AxPlug::AxEvent> reply)
+{
+    PendingRequest pending;
+    {
+        std::lock_guard<std::mutex> lock(requestMutex_);
+        auto it = pendingRequests_.find(correlationId);
+        if (it == pendingRequests_.end())
+            return false;
+        pending = std::move(it->second);
+        pendingRequests_.erase(it);
+    }
+    pending.timeout.reset(); // cancels the timer unless it is the one running
+
+    try
+    {
+        pending.onReply(std::move(reply));
+    }
+    catch (const std::exception& e)
+    {
+        ReportException(e);
+    }
+    catch (...)
+    {
+        ReportUnknownException();
+    }
+    return true;
+}
+
 // ============================================================
 // GetSnapshot - COW read path (short lock, copy shared_ptr)
 // ============================================================
-DefaultEventBus::SubscriberList DefaultEventBus::GetSnapshot(uint64_t eventId)
+DefaultEventBus::SubscriberTablePtr DefaultEventBus::GetSnapshot(uint64_t eventId, EventEntry*& entry, uint64_t& visibleSeq, const std::shared_ptr<AxPlug::AxEvent>* latest)
+{
+    std::shared_ptr<AxPlug::AxEvent> previous; // released outside the lock
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    entry = &GetEntryLocked(eventId);
+    visibleSeq = subscribeSeq_;
+    if (latest && entry->sticky)
+    {
+        previous = std::move(entry->lastValue);
+        entry->lastValue = *latest;
+    }
+    return entry->subscribers; // shared_ptr copy is atomic refcount bump
+}
+
+// ============================================================
+// SetParallelDispatch - per-event opt-in, pool started on first use
+// ============================================================
+bool DefaultEventBus::SetParallelDispatch(uint64_t eventId, bool enabled)
+{
+    if (enabled && !dispatchPool_.IsRunning())
+    {
+        unsigned cores = std::thread::hardware_concurrency();
+        dispatchPool_.Start(cores > 1 ? cores - 1 : 1); // the publisher is the extra worker
+    }
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    GetEntryLocked(eventId).parallelDispatch.store(enabled, std::memory_order_relaxed);
+    return true;
+}
+
+// ============================================================
+// GetEventStats / GetAllEventStats - metrics query API
+// ============================================================
+void DefaultEventBus::FillStats(uint64_t eventId, const EventEntry& entry, AxPlug::EventStats& stats)
+{
+    stats.eventId = eventId;
+    stats.publishes = entry.metrics.publishes.load(std::memory_order_relaxed);
+    stats.deliveries = entry.metrics.deliveries.load(std::memory_order_relaxed);
+    stats.drops = entry.metrics.drops.load(std::memory_order_relaxed);
+    stats.subscribers = 0;
+    stats.quarantined = 0;
+    if (entry.subscribers)
+    {
+        entry.subscribers->ForEach([&](const SubscriberPtr& sub) {
+            if (!sub->connection.IsActive())
+                return;
+            ++stats.subscribers;
+            if (sub->quarantine.load(std::memory_order_relaxed))
+                ++stats.quarantined;
+        });
+    }
+    stats.callback = entry.metrics.callbackNs.Snapshot();
+    stats.queueWait = entry.metrics.queueWaitNs.Snapshot();
+}
+
+bool DefaultEventBus::GetEventStats(uint64_t eventId, AxPlug::EventStats& stats)
 {
     std::lock_guard<std::mutex> lock(subscriberMutex_);
     auto it = subscriberMap_.find(eventId);
     if (it == subscriberMap_.end())
-        return nullptr;
-    return it->second; // shared_ptr copy is atomic refcount bump
+        return false;
+    FillStats(eventId, *it->second, stats);
+    return true;
+}
+
+std::vector<AxPlug::EventStats> DefaultEventBus::GetAllEventStats()
+{
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    std::vector<AxPlug::EventStats> all(subscriberMap_.size());
+    size_t i = 0;
+    for (const auto& kv : subscriberMap_)
+        FillStats(kv.first, *kv.second, all[i++]);
+    return all;
+}
+
+bool DefaultEventBus::GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts)
+{
+    std::lock_guard<std::mutex> lock(subscriberMutex_);
+    for (size_t i = 0; i < count; ++i)
+    {
+        counts[i] = 0;
+        auto it = subscriberMap_.find(eventIds[i]);
+        if (it == subscriberMap_.end() || !it->second->subscribers)
+            continue;
+        it->second->subscribers->ForEach([&](const SubscriberPtr& sub) {
+            counts[i] += sub->connection.IsActive() ? 1 : 0;
+        });
+    }
+    return true;
 }
 
 // ============================================================
 // DispatchDirect - synchronous fan-out on caller's thread
 // ============================================================
-void DefaultEventBus::DispatchDirect(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload)
+void DefaultEventBus::DispatchDirect(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>& payload)
+{
+    DispatchBatch(eventId, &payload, 1);
+}
+
+// ============================================================
+// DeliverOne - one subscriber, one payload
+// ============================================================
+DefaultEventBus::DeliveryResult DefaultEventBus::DeliverOne(uint64_t eventId, const SubscriberPtr& sub, const std::shared_ptr<AxPlug::AxEvent>& payload, bool skipMailboxes, EventMetrics& metrics, std::chrono::steady_clock::time_point& cbStart)
+{
+    if (!sub->connection.IsActive())
+        return DeliveryResult::Skipped;
+
+    // Subscriber-thread delivery: hand off to the owner's inbox, no timing needed
+    if (sub->viaMailbox)
+    {
+        if (skipMailboxes)
+            return DeliveryResult::Skipped;
+        auto mailbox = sub->mailbox.lock();
+        if (!mailbox)
+        {
+            sub->connection.Disconnect(); // owner dropped its inbox; let GC purge it
+            return DeliveryResult::Skipped;
+        }
+        if (mailbox->Post({ std::shared_ptr<const AxPlug::EventHandler>(sub, &sub->handler), payload, &sub->connection }))
+            return DeliveryResult::Delivered;
+        return DeliveryResult::Dropped;
+    }
+
+    // Quarantined for being slow: runs on its own worker, in order
+    if (auto* quarantine = sub->quarantine.load(std::memory_order_acquire))
+    {
+        if (quarantine->Post({ std::shared_ptr<const AxPlug::EventHandler>(sub, &sub->handler), payload, &sub->connection }))
+            return DeliveryResult::Delivered;
+        return DeliveryResult::Dropped;
+    }
+
+    // Exception isolation: catch callback throws to prevent crashing the bus
+    try {
+        sub->handler(payload);
+    } catch (const std::exception& e) {
+        ReportException(e);
+    } catch (...) {
+        ReportUnknownException();
+    }
+    auto cbEnd = std::chrono::steady_clock::now();
+    auto cbDurationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(cbEnd - cbStart).count();
+    metrics.callbackNs.Record(static_cast<uint64_t>(cbDurationNs));
+    if (cbDurationNs > CALLBACK_WARN_THRESHOLD_US * 1000)
+    {
+        fprintf(stderr, "[EventBus WARNING] Callback for eventId=0x%llx blocked bus for %lld us (threshold=%lld us)\n", static_cast<unsigned long long>(eventId), static_cast<long long>(cbDurationNs / 1000), static_cast<long long>(CALLBACK_WARN_THRESHOLD_US));
+    }
+
+    // Watchdog: consecutive over-budget runs lead to quarantine
+    const uint32_t strikeLimit = slowStrikeLimit_.load(std::memory_order_relaxed);
+    if (strikeLimit != 0)
+    {
+        if (cbDurationNs > slowBudgetNs_.load(std::memory_order_relaxed))
+        {
+            if (sub->slowStrikes.fetch_add(1, std::memory_order_relaxed) + 1 >= strikeLimit)
+                Quarantine(eventId, sub, cbDurationNs);
+        }
+        else if (sub->slowStrikes.load(std::memory_order_relaxed) != 0)
+        {
+            sub->slowStrikes.store(0, std::memory_order_relaxed);
+        }
+    }
+    cbStart = cbEnd;
+    return DeliveryResult::Delivered;
+}
+
+// ============================================================
+// Quarantine - give a slow subscriber its own worker thread and inbox
+// ============================================================
+void DefaultEventBus::SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes)
+{
+    slowBudgetNs_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(budget).count(), std::memory_order_relaxed);
+    slowStrikeLimit_.store(strikes, std::memory_order_relaxed);
+}
+
+void DefaultEventBus::Quarantine(uint64_t eventId, const SubscriberPtr& sub, int64_t callbackNs)
+{
+    {
+        std::lock_guard<std::mutex> lock(quarantineMutex_);
+        if (sub->quarantine.load(std::memory_order_relaxed) || !quarantineRunning_.load(std::memory_order_relaxed))
+            return;
+
+        // Reuse a worker whose subscriber is gone; its leftover deliveries are skipped as disconnected
+        QuarantineWorker* worker = nullptr;
+        for (auto& w : quarantineWorkers_)
+        {
+            auto owner = w->owner.lock();
+            if (!owner || !owner->connection.IsActive())
+            {
+                worker = w.get();
+                break;
+            }
+        }
+        if (!worker)
+        {
+            if (quarantineWorkers_.size() >= MAX_QUARANTINE_WORKERS)
+            {
+                sub->slowStrikes.store(0, std::memory_order_relaxed);
+                fprintf(stderr, "[EventBus WARNING] Slow subscriber on eventId=0x%llx not quarantined: all %zu quarantine workers in use\n", static_cast<unsigned long long>(eventId), MAX_QUARANTINE_WORKERS);
+                return;
+            }
+            auto created = std::make_unique<QuarantineWorker>();
+            created->mailbox = std::make_shared<AxPlug::EventMailbox>(QUARANTINE_QUEUE_CAPACITY);
+            created->mailbox->SetExceptionHandler([this](const std::exception& e) { ReportException(e); });
+            created->thread = std::thread([this, mailbox = created->mailbox.get()]() {
+                while (quarantineRunning_.load(std::memory_order_acquire))
+                {
+                    mailbox->WaitFor(std::chrono::milliseconds(QUARANTINE_WAIT_MS));
+                    mailbox->Drain();
+                }
+            });
+            worker = created.get();
+            quarantineWorkers_.push_back(std::move(created));
+        }
+        worker->owner = sub;
+        sub->quarantine.store(worker->mailbox.get(), std::memory_order_release);
+    }
+
+    fprintf(stderr, "[EventBus WARNING] Subscriber on eventId=0x%llx quarantined after %u callbacks over %lld us (last %lld us)\n", static_cast<unsigned long long>(eventId), slowStrikeLimit_.load(std::memory_order_relaxed), static_cast<long long>(slowBudgetNs_.load(std::memory_order_relaxed) / 1000), static_cast<long long>(callbackNs / 1000));
+    auto notice = AxPlug::MakeEvent<AxPlug::SubscriberQuarantinedEvent>();
+    notice->eventId = eventId;
+    notice->lastCallbackUs = static_cast<uint64_t>(callbackNs / 1000);
+    Publish(AxPlug::EVENT_SUBSCRIBER_QUARANTINED, std::move(notice), AxPlug::DispatchMode::Queued);
+}
+
+// ============================================================
+// DispatchBatch - in-order fan-out of one or more payloads
+// ============================================================
+void DefaultEventBus::DispatchBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, bool skipMailboxes, int64_t queueWaitNs, uint64_t publishedSeq)
 {
     AX_PROFILE_SCOPE("EventBus::DispatchDirect");
-    SubscriberList snapshot = GetSnapshot(eventId);
-    if (!snapshot || snapshot->empty())
+    // Mailboxes already got a Queued publish (and stored it if sticky)
+    EventEntry* entry = nullptr;
+    uint64_t visibleSeq = 0;
+    SubscriberTablePtr snapshot = GetSnapshot(eventId, entry, visibleSeq, skipMailboxes ? nullptr : &payloads[count - 1]);
+    visibleSeq = (std::min)(visibleSeq, publishedSeq); // the sticky value was stored at publish time
+    EventMetrics& metrics = entry->metrics;
+    if (!skipMailboxes)
+        metrics.publishes.fetch_add(count, std::memory_order_relaxed);
+    if (queueWaitNs >= 0)
+        metrics.queueWaitNs.Record(static_cast<uint64_t>(queueWaitNs));
+    if (!snapshot || snapshot->Empty())
         return;
 
-    for (const auto& sub : *snapshot)
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;
+    auto countResult = [&](DeliveryResult result) {
+        if (result == DeliveryResult::Delivered)
+            ++delivered;
+        else if (result == DeliveryResult::Dropped)
+            ++dropped;
+    };
+
+    // Parallel fan-out needs at least two callbacks to overlap. Replay stays
+    // sequential: its "don't journal again" flag is per thread.
+    const bool parallel = entry->parallelDispatch.load(std::memory_order_relaxed) && !t_replayingJournal && entry->directCount.load(std::memory_order_relaxed) >= 2;
+
+    // Phase 3: Per-callback timing with WARNING on timeout.
+    // Timestamps are chained: each callback's end time is the next one's start.
+    auto cbStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < count; ++i)
     {
-        auto conn = sub.connection.lock();
-        if (!conn || !conn->IsActive())
-            continue;
+        const auto& payload = payloads[i];
+        const auto wildcard = snapshot->Wildcard();
+        // Sender index: only subscribers filtering on this payload's sender
+        const auto matching = snapshot->Matching(payload ? payload->sender : nullptr);
+        const size_t fanOut = wildcard.size() + matching.size();
 
-        // Sender filter: if specificSender was set, only match that sender
-        if (sub.specificSender != nullptr && sub.specificSender != payload->sender)
+        if (parallel && fanOut >= 2)
+        {
+            // Join per payload, so batch order is kept across payloads
+            std::atomic<uint64_t> parallelDelivered{ 0 };
+            std::atomic<uint64_t> parallelDropped{ 0 };
+            dispatchPool_.ParallelFor(fanOut, [&](size_t k) {
+                const SubscriberPtr& sub = k < wildcard.size() ? wildcard[k] : matching[k - wildcard.size()];
+                if (sub->subscribeSeq > visibleSeq)
+                    return;
+                auto start = std::chrono::steady_clock::now();
+                DeliveryResult result = DeliverOne(eventId, sub, payload, skipMailboxes, metrics, start);
+                if (result == DeliveryResult::Delivered)
+                    parallelDelivered.fetch_add(1, std::memory_order_relaxed);
+                else if (result == DeliveryResult::Dropped)
+                    parallelDropped.fetch_add(1, std::memory_order_relaxed);
+            });
+            delivered += parallelDelivered.load(std::memory_order_relaxed);
+            dropped += parallelDropped.load(std::memory_order_relaxed);
+            cbStart = std::chrono::steady_clock::now();
             continue;
+        }
 
-        // Phase 3: Per-callback timing with WARNING on timeout
-        // Exception isolation: catch callback throws to prevent crashing the bus
-        auto cbStart = std::chrono::steady_clock::now();
-        try {
-            sub.callback(payload);
-        } catch (const std::exception& e) {
-            ReportException(e);
-        } catch (...) {
-            ReportUnknownException();
+        // Subscribers appended after the snapshot got the sticky value instead
+        for (const auto& sub : wildcard)
+        {
+            if (sub->subscribeSeq <= visibleSeq)
+                countResult(DeliverOne(eventId, sub, payload, skipMailboxes, metrics, cbStart));
         }
-        auto cbEnd = std::chrono::steady_clock::now();
-        auto cbDurationUs = std::chrono::duration_cast<std::chrono::microseconds>(cbEnd - cbStart).count();
-        if (cbDurationUs > CALLBACK_WARN_THRESHOLD_US)
+        for (const auto& sub : matching)
         {
-            fprintf(stderr, "[EventBus WARNING] Callback for eventId=0x%llx blocked bus for %lld us (threshold=%lld us)\n", static_cast<unsigned long long>(eventId), static_cast<long long>(cbDurationUs), static_cast<long long>(CALLBACK_WARN_THRESHOLD_US));
+            if (sub->subscribeSeq <= visibleSeq)
+                countResult(DeliverOne(eventId, sub, payload, skipMailboxes, metrics, cbStart));
         }
     }
 
-    // Periodic lazy GC
-    uint32_t count = publishCount_.fetch_add(1, std::memory_order_relaxed);
-    if ((count & (GC_INTERVAL - 1)) == 0)
+    if (delivered)
+        metrics.deliveries.fetch_add(delivered, std::memory_order_relaxed);
+    if (dropped)
+        metrics.drops.fetch_add(dropped, std::memory_order_relaxed);
+
+    // Periodic lazy GC (one tick per dispatch, not per payload)
+    uint32_t gcTick = publishCount_.fetch_add(1, std::memory_order_relaxed);
+    if ((gcTick & (GC_INTERVAL - 1)) == 0)
     {
         PurgeExpired(eventId);
     }
@@ -174,34 +1113,79 @@ void DefaultEventBus::PurgeExpired(uint64_t eventId)
 {
     std::lock_guard<std::mutex> lock(subscriberMutex_);
     auto it = subscriberMap_.find(eventId);
-    if (it == subscriberMap_.end())
+    if (it == subscriberMap_.end() || !it->second->subscribers)
         return;
+    EventEntry& entry = *it->second;
 
     // Check if any expired
+    size_t live = 0;
+    size_t liveDirect = 0;
     bool hasExpired = false;
-    for (const auto& sub : *it->second)
-    {
-        auto conn = sub.connection.lock();
-        if (!conn || !conn->IsActive())
+    entry.subscribers->ForEach([&](const SubscriberPtr& sub) {
+        if (!sub->connection.IsActive())
         {
             hasExpired = true;
-            break;
+            return;
         }
-    }
+        ++live;
+        liveDirect += sub->viaMailbox ? 0 : 1;
+    });
 
     if (!hasExpired)
         return;
 
-    // COW: clone, erase expired, replace
-    auto newList = std::make_shared<std::vector<Subscriber>>();
-    newList->reserve(it->second->size());
-    for (auto& sub : *it->second)
+    // COW: rebuild with live subscribers only; empty sender buckets are dropped,
+    // and a table with nobody left is released entirely
+    entry.directCount.store(liveDirect, std::memory_order_relaxed);
+    if (live == 0)
     {
-        auto conn = sub.connection.lock();
-        if (conn && conn->IsActive())
-            newList->push_back(std::move(sub));
+        entry.subscribers.reset();
+        return;
     }
-    it->second = std::move(newList);
+    auto newTable = std::make_shared<SubscriberTable>();
+    if (entry.subscribers->wildcard && entry.subscribers->wildcard->Size() != 0)
+    {
+        newTable->wildcard = RebuildArray(entry.subscribers->wildcard.get(), 0);
+        if (newTable->wildcard->Size() == 0)
+            newTable->wildcard.reset();
+    }
+    for (const auto& bucket : entry.subscribers->bySender)
+    {
+        auto array = RebuildArray(bucket.second.get(), 0);
+        if (array->Size() != 0)
+            newTable->bySender.emplace(bucket.first, std::move(array));
+    }
+    entry.subscribers = std::move(newTable);
+}
+
+// ============================================================
+// SweepExpired - background GC, a bounded slice of eventIds per run
+// ============================================================
+void DefaultEventBus::SweepExpired()
+{
+    if (sweepCursor_ >= sweepIds_.size())
+    {
+        sweepIds_.clear();
+        sweepCursor_ = 0;
+        std::lock_guard<std::mutex> lock(subscriberMutex_);
+        for (const auto& kv : subscriberMap_)
+        {
+            if (kv.second->subscribers)
+                sweepIds_.push_back(kv.first);
+        }
+        // Pattern buckets are otherwise only pruned when their prefix is touched again
+        for (auto it = patternSubscribers_.begin(); it != patternSubscribers_.end();)
+        {
+            auto& bucket = it->second;
+            bucket.erase(std::remove_if(bucket.begin(), bucket.end(), [](const SubscriberPtr& s) { return !s->connection.IsActive(); }), bucket.end());
+            it = bucket.empty() ? patternSubscribers_.erase(it) : std::next(it);
+        }
+    }
+
+    // Each PurgeExpired takes the lock on its own, so publishers are never held up for a whole sweep
+    size_t end = (std::min)(sweepCursor_ + SWEEP_BATCH, sweepIds_.size());
+    for (; sweepCursor_ < end; ++sweepCursor_)
+        PurgeExpired(sweepIds_[sweepCursor_]);
 }
 
 // ============================================================
@@ -209,34 +1193,105 @@ void DefaultEventBus::PurgeExpired(uint64_t eventId)
 // ============================================================
 void DefaultEventBus::EventLoopThread()
 {
+    // Latest clock reading taken by the loop; due timers are checked against it
+    // so a busy loop does not read the clock again just for the wheel
+    auto lastSeen = EventTimerWheel::Clock::now();
     while (running_.load(std::memory_order_acquire))
     {
         QueuedEvent evt;
+        bool haveEvent = false;
+        bool timersActive = false;
+        std::vector<std::pair<EventTimerWheel::TaskPtr, EventTimerWheel::Clock::time_point>> newTimers;
         {
             std::unique_lock<std::mutex> lock(queueMutex_);
-            queueCV_.wait(lock, [this]() { return !asyncQueue_.empty() || !running_.load(std::memory_order_acquire); });
+            auto ready = [this]() {
+                if (!pendingTimers_.empty() || !running_.load(std::memory_order_acquire))
+                    return true;
+                for (const auto& lane : asyncQueues_)
+                    if (!lane.empty())
+                        return true;
+                return false;
+            };
+            // Only this thread touches the wheel, so the deadline stays valid after the wait
+            const auto wheelDue = timerWheel_.Empty() ? EventTimerWheel::Clock::time_point::max() : timerWheel_.NextWakeTime();
+            loopWakeAt_ = wheelDue;
+            bool timedOut = false;
+            if (wheelDue == EventTimerWheel::Clock::time_point::max())
+                queueCV_.wait(lock, ready);
+            else
+                timedOut = !queueCV_.wait_until(lock, wheelDue, ready);
+            loopWakeAt_ = EventTimerWheel::Clock::time_point::min(); // awake: pending timers are seen before the next wait
 
-            if (!running_.load(std::memory_order_acquire) && asyncQueue_.empty())
+            if (!running_.load(std::memory_order_acquire) && !ready())
                 break;
 
-            if (asyncQueue_.empty())
-                continue;
+            // The wheel is never empty once the sweep task runs, so take the timer
+            // path only when something is due; otherwise pop under this same lock.
+            // A deadline that lastSeen has not reached yet is caught by the next
+            // dequeue's reading, at most one event late.
+            newTimers.swap(pendingTimers_);
+            timersActive = !newTimers.empty() || timedOut || wheelDue <= lastSeen;
+            if (!timersActive)
+                haveEvent = PopNextQueued(evt);
+        }
 
-            evt = std::move(asyncQueue_.front());
-            asyncQueue_.pop();
+        // Timer wheel: fire due tasks before picking the next event, so a due
+        // Critical timer is not served behind an already-dequeued Bulk entry
+        if (timersActive)
+        {
+            const auto now = EventTimerWheel::Clock::now();
+            lastSeen = now;
+            for (auto& timer : newTimers)
+            {
+                auto& task = timer.first;
+                // Zero-delay one-shots are posts to this thread: run them now, not a tick later
+                if (task->period != 0 || timer.second > now)
+                {
+                    timerWheel_.Add(std::move(task), timer.second);
+                    continue;
+                }
+                if (!task->connection.IsActive())
+                    continue;
+                try
+                {
+                    task->fn();
+                }
+                catch (const std::exception& e)
+                {
+                    ReportException(e);
+                }
+                catch (...)
+                {
+                    ReportUnknownException();
+                }
+            }
+            timerWheel_.Advance([this](const std::exception& e) { ReportException(e); });
+
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            haveEvent = PopNextQueued(evt);
+        }
+
+        if (!haveEvent)
+        {
+            if (!running_.load(std::memory_order_acquire))
+                break;
+            continue;
         }
 
-        // Phase 3: Queue latency monitoring
+        // Phase 3: Queue latency monitoring (histogram is recorded by DispatchBatch)
         auto dequeueTime = std::chrono::steady_clock::now();
-        auto latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(dequeueTime - evt.enqueueTime).count();
+        lastSeen = dequeueTime;
+        auto latencyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(dequeueTime - evt.enqueueTime).count();
+        auto latencyUs = latencyNs / 1000;
         if (latencyUs > CALLBACK_WARN_THRESHOLD_US)
         {
-            fprintf(stderr, "[EventBus WARNING] Queued event 0x%llx waited %lld us in queue\n", static_cast<unsigned long long>(evt.eventId), static_cast<long long>(latencyUs));
+            static const char* const laneNames[PRIORITY_LANES] = { "critical", "normal", "bulk" };
+            fprintf(stderr, "[EventBus WARNING] Queued event 0x%llx waited %lld us in %s queue\n", static_cast<unsigned long long>(evt.eventId), static_cast<long long>(latencyUs), laneNames[static_cast<size_t>(evt.priority) % PRIORITY_LANES]);
         }
 
         // Dispatch on the event loop thread (with exception isolation)
         try {
-            DispatchDirect(evt.eventId, std::move(evt.payload));
+            DispatchQueued(evt, latencyNs);
         } catch (const std::exception& e) {
             ReportException(e);
         } catch (...) {
@@ -244,18 +1299,47 @@ void DefaultEventBus::EventLoopThread()
         }
     }
 
-    // Drain remaining events before exit (with exception isolation)
-    std::lock_guard<std::mutex> lock(queueMutex_);
-    while (!asyncQueue_.empty())
+    // Drain remaining events before exit, in lane order (with exception isolation).
+    // The lanes are swapped out first: callbacks may still publish Queued (a
+    // slow one triggers the quarantine notice), and Enqueue takes queueMutex_.
+    for (;;)
     {
-        auto evt = std::move(asyncQueue_.front());
-        asyncQueue_.pop();
-        try {
-            DispatchDirect(evt.eventId, std::move(evt.payload));
-        } catch (const std::exception& e) {
-            ReportException(e);
-        } catch (...) {
-            ReportUnknownException();
+        std::queue<QueuedEvent> lanes[PRIORITY_LANES];
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            bool empty = true;
+            for (size_t i = 0; i < PRIORITY_LANES; ++i)
+            {
+                lanes[i].swap(asyncQueues_[i]);
+                empty = empty && lanes[i].empty();
+            }
+            if (empty)
+                break;
+        }
+        for (auto& lane : lanes)
+        {
+            for (; !lane.empty(); lane.pop())
+            {
+                try {
+                    DispatchQueued(lane.front(), -1);
+                } catch (const std::exception& e) {
+                    ReportException(e);
+                } catch (...) {
+                    ReportUnknownException();
+                }
+            }
         }
     }
 }
+
+// ============================================================
+// DispatchQueued - dispatch one dequeued entry (single or batch)
+// ============================================================
+void DefaultEventBus::DispatchQueued(QueuedEvent& evt, int64_t queueWaitNs)
+{
+    const uint64_t seq = evt.mailboxesDelivered ? evt.visibleSeq : UINT64_MAX;
+    if (!evt.batch.empty())
+        DispatchBatch(evt.eventId, evt.batch.data(), evt.batch.size(), evt.mailboxesDelivered, queueWaitNs, seq);
+    else
+        DispatchBatch(evt.eventId, &evt.payload, 1, evt.mailboxesDelivered, queueWaitNs, seq);
+}
@@ -2,6 +2,10 @@
 
 #include "AxPlug/AxEventBus.h"
 #include "AxPlug/AxProfiler.h"
+#include "EventDispatchPool.h"
+#include "EventJournal.h"
+#include "EventMetrics.h"
+#include "EventTimerWheel.h"
 #include <vector>
 #include <unordered_map>
 #include <mutex>
@@ -19,61 +23,342 @@ public:
     ~DefaultEventBus() override;
 
     // IEventBus interface
-    void Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
-    AxPlug::EventConnectionPtr Subscribe(uint64_t eventId, AxPlug::EventCallback callback, void* specificSender = nullptr) override;
+    void Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    void PublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr Subscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    std::vector<AxPlug::EventConnectionPtr> SubscribeBulk(std::vector<AxPlug::SubscriptionRequest> requests) override;
+    AxPlug::EventConnectionPtr SubscribeOn(uint64_t eventId, AxPlug::EventMailboxPtr mailbox, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    uint64_t RegisterTopic(const char* name) override;
+    AxPlug::EventConnectionPtr SubscribePattern(const char* pattern, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    AxPlug::EventConnectionPtr PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, AxPlug::InlineFunction<void()> task) override;
+    uint64_t RequestAsync(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, std::chrono::milliseconds timeout, AxPlug::ReplyHandler onReply, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
+    bool Reply(const AxPlug::AxEvent& request, std::shared_ptr<AxPlug::AxEvent> reply) override;
+    bool OpenJournal(const char* path, size_t capacityBytes) override;
+    void CloseJournal() override;
+    bool JournalEvent(uint64_t eventId, AxPlug::JournalEventFactory factory) override;
+    size_t ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
+    bool SetParallelDispatch(uint64_t eventId, bool enabled) override;
+    bool SetSticky(uint64_t eventId, bool enabled) override;
+    bool GetEventStats(uint64_t eventId, AxPlug::EventStats& stats) override;
+    std::vector<AxPlug::EventStats> GetAllEventStats() override;
+    bool GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts) override;
+    void SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes) override;
     void SetExceptionHandler(AxPlug::ExceptionHandler handler) override;
 
     // Shutdown the async event loop
     void Shutdown();
 
 private:
-    // Internal subscriber record
+    // Internal subscriber record. The connection is embedded so dispatch checks
+    // liveness with a single acquire load (no weak_ptr lock per subscriber);
+    // the handle returned to the caller disconnects it when released.
     struct Subscriber
     {
-        std::weak_ptr<AxPlug::EventConnection> connection;
-        AxPlug::EventCallback callback;
-        void* specificSender;
+        AxPlug::EventConnection connection;
+        AxPlug::EventHandler handler;
+        void* specificSender = nullptr;
+        // Order of first insertion (set under subscriberMutex_ before the record is
+        // published). Dispatch skips records newer than its snapshot, since appends
+        // land in the arrays the snapshot shares.
+        uint64_t subscribeSeq = 0;
+        // Deliver into the subscriber's inbox. Weak: pending deliveries keep this
+        // record alive, so a strong reference would form a cycle with an undrained
+        // mailbox. The subscription ends once the owner releases its mailbox.
+        std::weak_ptr<AxPlug::EventMailbox> mailbox;
+        bool viaMailbox = false;
+        // Slow-subscriber watchdog: consecutive over-budget runs, and the
+        // quarantine worker's inbox once demoted (owned by quarantineWorkers_)
+        std::atomic<uint32_t> slowStrikes{ 0 };
+        std::atomic<AxPlug::EventMailbox*> quarantine{ nullptr };
     };
 
-    // COW subscriber list per event ID
-    using SubscriberList = std::shared_ptr<std::vector<Subscriber>>;
+    using SubscriberPtr = std::shared_ptr<Subscriber>;
 
-    // Get a COW snapshot of subscribers for an eventId (lock-free read after copy)
-    SubscriberList GetSnapshot(uint64_t eventId);
+    // Append-only subscriber array shared by successive table snapshots.
+    // Writers (under subscriberMutex_) fill the slot at `size` and publish it
+    // with a release store, so a reader always sees a fully written prefix and
+    // a slot is never rewritten once visible. Subscribe is O(1) amortised:
+    // only a full array is copied (into one twice as large, dropping dead
+    // subscribers on the way).
+    class SubscriberArray
+    {
+    public:
+        struct View
+        {
+            const SubscriberPtr* data;
+            size_t count;
+            const SubscriberPtr* begin() const { return data; }
+            const SubscriberPtr* end() const { return data + count; }
+            size_t size() const { return count; }
+            const SubscriberPtr& operator[](size_t i) const { return data[i]; }
+        };
+
+        explicit SubscriberArray(size_t capacity) : slots_(new SubscriberPtr[capacity]), capacity_(capacity) {}
+
+        View Items() const { return { slots_.get(), size_.load(std::memory_order_acquire) }; }
+        size_t Size() const { return size_.load(std::memory_order_acquire); }
+        bool Full() const { return size_.load(std::memory_order_relaxed) == capacity_; }
+        size_t Capacity() const { return capacity_; }
+
+        // Writer only (subscriberMutex_ held), and only while !Full()
+        void Append(SubscriberPtr sub)
+        {
+            size_t n = size_.load(std::memory_order_relaxed);
+            slots_[n] = std::move(sub);
+            size_.store(n + 1, std::memory_order_release);
+        }
+
+    private:
+        std::unique_ptr<SubscriberPtr[]> slots_;
+        const size_t capacity_;
+        std::atomic<size_t> size_{ 0 };
+    };
+    using SubscriberArrayPtr = std::shared_ptr<SubscriberArray>;
+
+    // COW subscriber table per event ID: wildcard subscribers plus an index by
+    // specificSender, so dispatch only visits callbacks matching the payload's sender.
+    // Wildcard subscribers run before sender-specific ones. Appends go into the
+    // shared arrays in place; the table itself is only cloned when an array is
+    // replaced or a new sender appears.
+    struct SubscriberTable
+    {
+        SubscriberArrayPtr wildcard;
+        std::unordered_map<void*, SubscriberArrayPtr> bySender;
+
+        bool Empty() const { return (!wildcard || wildcard->Size() == 0) && bySender.empty(); }
+
+        SubscriberArray::View Wildcard() const
+        {
+            return wildcard ? wildcard->Items() : SubscriberArray::View{ nullptr, 0 };
+        }
+
+        SubscriberArray::View Matching(void* sender) const
+        {
+            if (sender == nullptr || bySender.empty())
+                return { nullptr, 0 };
+            auto it = bySender.find(sender);
+            return it == bySender.end() ? SubscriberArray::View{ nullptr, 0 } : it->second->Items();
+        }
+
+        template <typename F>
+        void ForEach(F&& f) const
+        {
+            for (const auto& sub : Wildcard())
+                f(sub);
+            for (const auto& bucket : bySender)
+                for (const auto& sub : bucket.second->Items())
+                    f(sub);
+        }
+    };
+    using SubscriberTablePtr = std::shared_ptr<const SubscriberTable>;
+
+    // Smallest array allocated for a new wildcard / sender bucket
+    static constexpr size_t MIN_ARRAY_CAPACITY = 4;
+
+    // Per-eventId registry entry. Entries are never erased, so the metrics
+    // address is stable and can be used outside subscriberMutex_.
+    struct EventEntry
+    {
+        std::shared_ptr<SubscriberTable> subscribers; // guarded by subscriberMutex_
+        std::atomic<size_t> directCount{ 0 };          // subscribers not bound to a mailbox (live + not yet purged)
+        EventMetrics metrics;       // lock-free
+        // Registered topics only: hashes of the ancestor prefixes, e.g. "", "A", "A::B"
+        // for "A::B::C". Pattern subscribers are copied into `subscribers` when
+        // either side appears, so publishing never evaluates patterns.
+        std::vector<uint64_t> topicPrefixes;
+        bool isTopic = false;
+        std::atomic<bool> parallelDispatch{ false }; // DirectCall fan-out on dispatchPool_
+        bool sticky = false;                         // guarded by subscriberMutex_
+        std::shared_ptr<AxPlug::AxEvent> lastValue;  // sticky only; guarded by subscriberMutex_
+    };
+
+    // Entry of the MPSC queue for DispatchMode::Queued.
+    // A batch entry carries all its payloads in `batch` and leaves `payload` empty.
+    struct QueuedEvent
+    {
+        uint64_t eventId;
+        std::shared_ptr<AxPlug::AxEvent> payload;
+        std::chrono::steady_clock::time_point enqueueTime;
+        std::vector<std::shared_ptr<AxPlug::AxEvent>> batch;
+        bool mailboxesDelivered = false;
+        AxPlug::EventPriority priority = AxPlug::EventPriority::Normal;
+        uint64_t visibleSeq = 0; // mailboxesDelivered only: subscribers the publish-time snapshot covered
+    };
+
+    // Dispatch one dequeued entry (single event or batch)
+    void DispatchQueued(QueuedEvent& evt, int64_t queueWaitNs);
+
+    // Get a COW snapshot of subscribers for an eventId (lock-free read after copy).
+    // Creates the entry on first use so metrics are kept even without subscribers.
+    // `latest` (the newest payload being published) is stored on sticky entries in
+    // the same critical section, so a concurrent subscriber either is in the
+    // snapshot or receives it as the sticky value, never both. `visibleSeq` is the
+    // newest subscribeSeq the snapshot covers; dispatch must skip later records.
+    SubscriberTablePtr GetSnapshot(uint64_t eventId, EventEntry*& entry, uint64_t& visibleSeq, const std::shared_ptr<AxPlug::AxEvent>* latest = nullptr);
+
+    // Fill an EventStats from one entry (caller holds subscriberMutex_)
+    static void FillStats(uint64_t eventId, const EventEntry& entry, AxPlug::EventStats& stats);
+
+    enum class DeliveryResult { Skipped, Delivered, Dropped };
+
+    // Deliver one payload to one subscriber with exception isolation and timing.
+    // cbStart is the callback's start time; it is advanced to the end time so
+    // sequential dispatch can chain timestamps.
+    DeliveryResult DeliverOne(uint64_t eventId, const SubscriberPtr& sub, const std::shared_ptr<AxPlug::AxEvent>& payload, bool skipMailboxes, EventMetrics& metrics, std::chrono::steady_clock::time_point& cbStart);
 
     // Dispatch to subscribers synchronously on current thread
-    void DispatchDirect(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload);
+    void DispatchDirect(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>& payload);
+
+    // Dispatch a batch in order: one snapshot + one GC tick for the whole batch.
+    // skipMailboxes: mailbox subscribers were already served (and the publish counted) at publish time.
+    // queueWaitNs >= 0 records the Queued wait into the event's histogram.
+    // publishedSeq limits delivery to subscribers present at an earlier snapshot
+    // (the one that stored the sticky value when mailboxes were served at publish).
+    void DispatchBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, bool skipMailboxes = false, int64_t queueWaitNs = -1, uint64_t publishedSeq = UINT64_MAX);
+
+    // Common COW insert for Subscribe / SubscribeOn
+    AxPlug::EventConnectionPtr AddSubscriber(uint64_t eventId, SubscriberPtr sub);
+
+    // Sticky payload waiting to be handed to a new subscriber once the lock is released
+    struct StickyDelivery
+    {
+        uint64_t eventId;
+        EventEntry* entry;
+        SubscriberPtr sub;
+        std::shared_ptr<AxPlug::AxEvent> payload;
+    };
+    static void CollectStickyLocked(uint64_t eventId, EventEntry& entry, const SubscriberPtr& sub, std::vector<StickyDelivery>& out);
+    void DeliverSticky(const std::vector<StickyDelivery>& pending);
+
+    // Find or create the entry for an eventId (caller holds subscriberMutex_)
+    EventEntry& GetEntryLocked(uint64_t eventId);
+
+    // Append all of `subs` to the entry's table (caller holds subscriberMutex_).
+    // The table is cloned at most once, and only if an array must be replaced
+    // or a new sender bucket is needed.
+    void InsertLocked(EventEntry& entry, const SubscriberPtr* subs, size_t count);
+
+    // Copy the live subscribers of `old` into a new array with room for `extra` more.
+    // Dead non-mailbox subscribers left behind are added to *purgedDirect, so the
+    // caller can keep directCount in step.
+    static SubscriberArrayPtr RebuildArray(const SubscriberArray* old, size_t extra, size_t* purgedDirect = nullptr);
+
+    // Queued publish: push straight into mailbox subscribers' inboxes on the publisher
+    // thread. Returns true if the event still needs the bus thread (non-mailbox subscribers);
+    // visibleSeq receives the snapshot's subscribeSeq for that later dispatch.
+    bool PostToMailboxes(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, uint64_t& visibleSeq);
+
+    // Append journaled payloads to the journal (skipped while replaying on this thread)
+    void RecordJournal(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count);
+
+    // Enqueue one entry into its priority lane
+    void Enqueue(QueuedEvent evt);
+
+    // Pick the next entry across lanes (caller holds queueMutex_).
+    // Critical is strict; Normal and Bulk are weighted NORMAL_BULK_WEIGHT:1.
+    bool PopNextQueued(QueuedEvent& out);
 
     // Lazy GC: purge expired connections from a subscriber list
     void PurgeExpired(uint64_t eventId);
 
+    // Remove a pending request and run its continuation. Returns false if it
+    // was already completed (replied, timed out or failed at shutdown).
+    bool CompleteRequest(uint64_t correlationId, std::shared_ptr<AxPlug::AxEvent> reply);
+
+    // Move a repeatedly slow subscriber onto a quarantine worker (any dispatch thread)
+    void Quarantine(uint64_t eventId, const SubscriberPtr& sub, int64_t callbackNs);
+
+    // Background GC on the event loop: purges up to SWEEP_BATCH entries per run,
+    // cycling through every eventId, so rarely published events are cleaned too
+    void SweepExpired();
+
     // MPSC async event loop thread function
     void EventLoopThread();
 
     // --- Data members ---
 
-    // COW registry: eventId -> shared_ptr<vector<Subscriber>>
-    std::unordered_map<uint64_t, SubscriberList> subscriberMap_;
+    // Registry: eventId -> { COW subscriber table, metrics }
+    std::unordered_map<uint64_t, std::unique_ptr<EventEntry>> subscriberMap_;
+    // Pattern subscriptions: prefix hash -> subscribers (guarded by subscriberMutex_)
+    std::unordered_map<uint64_t, std::vector<SubscriberPtr>> patternSubscribers_;
     std::mutex subscriberMutex_;
+    uint64_t subscribeSeq_ = 0; // last Subscriber::subscribeSeq handed out; guarded by subscriberMutex_
 
-    // MPSC queue for DispatchMode::Queued
-    struct QueuedEvent
-    {
-        uint64_t eventId;
-        std::shared_ptr<AxPlug::AxEvent> payload;
-        std::chrono::steady_clock::time_point enqueueTime;
-    };
+    // MPSC queues for DispatchMode::Queued, one lane per EventPriority
 
-    std::queue<QueuedEvent> asyncQueue_;
+    static constexpr size_t PRIORITY_LANES = 3;
+    static constexpr uint32_t NORMAL_BULK_WEIGHT = 8; // Normal entries served per Bulk entry under contention
+    std::queue<QueuedEvent> asyncQueues_[PRIORITY_LANES];
+    uint32_t normalStreak_ = 0; // guarded by queueMutex_
+
+    // Timers: handed to the loop through pendingTimers_ (guarded by queueMutex_);
+    // timerWheel_ itself is only touched by the event loop thread
+    std::vector<std::pair<EventTimerWheel::TaskPtr, EventTimerWheel::Clock::time_point>> pendingTimers_;
+    EventTimerWheel timerWheel_;
+    // When the sleeping loop will wake on its own (min() while awake); guarded by queueMutex_
+    EventTimerWheel::Clock::time_point loopWakeAt_ = EventTimerWheel::Clock::time_point::min();
     std::mutex queueMutex_;
     std::condition_variable queueCV_;
     std::thread eventLoopThread_;
     std::atomic<bool> running_{ false };
 
+    // Number of mailbox-bound subscriptions ever made; gates the Queued-path
+    // mailbox shortcut so buses without mailboxes skip the extra snapshot
+    std::atomic<uint32_t> mailboxSubscriptions_{ 0 };
+
+    // Workers for parallel DirectCall fan-out; started on the first SetParallelDispatch
+    EventDispatchPool dispatchPool_;
+
+    // Opt-in event journal; factories are only needed for replay
+    EventJournal journal_;
+    std::unordered_map<uint64_t, AxPlug::JournalEventFactory> journalFactories_;
+    std::mutex journalMutex_;
+    static constexpr size_t JOURNAL_SCRATCH_KEEP_BYTES = 1024 * 1024; // per-thread SerializeTo buffer kept up to this
+
+    // Request/reply: correlationId -> continuation + its timeout timer.
+    // Completing erases the entry, which also cancels the timer.
+    struct PendingRequest
+    {
+        AxPlug::ReplyHandler onReply;
+        AxPlug::EventConnectionPtr timeout;
+    };
+    std::unordered_map<uint64_t, PendingRequest> pendingRequests_;
+    std::mutex requestMutex_;
+    std::atomic<uint64_t> nextCorrelationId_{ 1 };
+
     // GC counter: triggers purge every N publishes
     std::atomic<uint32_t> publishCount_{ 0 };
     static constexpr uint32_t GC_INTERVAL = 64;
 
+    // Background sweeper (ScheduleTask); sweepIds_/sweepCursor_ are event loop only
+    AxPlug::EventConnectionPtr sweepTask_;
+    std::vector<uint64_t> sweepIds_;
+    size_t sweepCursor_ = 0;
+    static constexpr int64_t SWEEP_INTERVAL_MS = 1000;
+    static constexpr size_t SWEEP_BATCH = 256;
+
+    // Slow-subscriber quarantine: one worker thread + inbox per demoted
+    // subscriber. Workers live until Shutdown; a worker whose subscriber has
+    // disconnected is handed to the next offender.
+    struct QuarantineWorker
+    {
+        std::shared_ptr<AxPlug::EventMailbox> mailbox;
+        std::weak_ptr<Subscriber> owner;
+        std::thread thread;
+    };
+    std::vector<std::unique_ptr<QuarantineWorker>> quarantineWorkers_;
+    std::mutex quarantineMutex_;
+    std::atomic<bool> quarantineRunning_{ true };
+    std::atomic<int64_t> slowBudgetNs_{ DEFAULT_SLOW_BUDGET_US * 1000 };
+    std::atomic<uint32_t> slowStrikeLimit_{ DEFAULT_SLOW_STRIKES };
+    static constexpr int64_t DEFAULT_SLOW_BUDGET_US = 50000; // 50ms
+    static constexpr uint32_t DEFAULT_SLOW_STRIKES = 0; // off until the host opts in
+    static constexpr size_t MAX_QUARANTINE_WORKERS = 8;
+    static constexpr size_t QUARANTINE_QUEUE_CAPACITY = 4096;
+    static constexpr int QUARANTINE_WAIT_MS = 100;
+
     // Phase 3: Callback timeout WARNING threshold (microseconds)
     static constexpr int64_t CALLBACK_WARN_THRESHOLD_US = 16000; // 16ms
 
@@ -0,0 +1,124 @@
+#include "EventDispatchPool.h"
+#include <algorithm>
+
+EventDispatchPool::~EventDispatchPool()
+{
+    Stop();
+}
+
+void EventDispatchPool::Start(unsigned workers)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_.load(std::memory_order_relaxed) || stopping_)
+        return;
+    workers = (std::min)((std::max)(workers, 1u), MAX_WORKERS);
+    for (unsigned i = 0; i < workers; ++i)
+        workers_.emplace_back(&EventDispatchPool::WorkerThread, this);
+    running_.store(true, std::memory_order_release);
+}
+
+void EventDispatchPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_.load(std::memory_order_relaxed))
+            return;
+        running_.store(false, std::memory_order_release);
+        stopping_ = true;
+    }
+    workCV_.notify_all();
+    for (auto& worker : workers_)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    workers_.clear();
+    stopping_ = false;
+}
+
+// ============================================================
+// Run - post the job, work on it ourselves, then wait for stragglers
+// ============================================================
+void EventDispatchPool::Run(Job& job)
+{
+    if (job.count == 0)
+        return;
+
+    bool posted = false;
+    if (job.count > 1)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_.load(std::memory_order_relaxed))
+        {
+            jobs_.push_back(&job);
+            posted = true;
+        }
+    }
+    if (!posted)
+    {
+        for (size_t i = 0; i < job.count; ++i)
+            job.invoke(job.context, i);
+        return;
+    }
+
+    workCV_.notify_all();
+    size_t index = job.next.fetch_add(1, std::memory_order_relaxed);
+    if (index < job.count)
+        Work(job, index);
+
+    // Every index is claimed now; unpost the job and wait for the ones still running
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = std::find(jobs_.begin(), jobs_.end(), &job);
+    if (it != jobs_.end())
+        jobs_.erase(it);
+    doneCV_.wait(lock, [&] { return job.done.load(std::memory_order_acquire) == job.count; });
+}
+
+void EventDispatchPool::Work(Job& job, size_t index)
+{
+    void* context = job.context;
+    auto invoke = job.invoke;
+    const size_t count = job.count;
+    for (;;)
+    {
+        invoke(context, index);
+        // Claim the next index before marking this one done: while we hold an
+        // unfinished index the owner is still waiting, so `job` stays alive
+        size_t next = job.next.fetch_add(1, std::memory_order_relaxed);
+        if (job.done.fetch_add(1, std::memory_order_acq_rel) + 1 == count)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            doneCV_.notify_all();
+        }
+        if (next >= count)
+            return;
+        index = next;
+    }
+}
+
+// ============================================================
+// WorkerThread - take the oldest job that still has unclaimed indices
+// ============================================================
+void EventDispatchPool::WorkerThread()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;)
+    {
+        workCV_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        if (jobs_.empty())
+            return; // stopping
+
+        Job* job = jobs_.front();
+        size_t index = job->next.fetch_add(1, std::memory_order_relaxed);
+        if (index >= job->count)
+        {
+            jobs_.pop_front(); // fully claimed; its owner is already waiting
+            continue;
+        }
+
+        lock.unlock();
+        Work(*job, index);
+        lock.lock();
+    }
+}
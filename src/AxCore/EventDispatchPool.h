@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// ============================================================
+// EventDispatchPool - fork/join workers for parallel DirectCall fan-out
+//
+// ParallelFor(n, body) runs body(0) .. body(n-1) on the calling thread and
+// the pool workers and returns when every index has finished. Indices are
+// claimed one at a time from the job's atomic cursor, so whichever thread
+// is free takes the next callback and the join waits roughly for the
+// slowest callback rather than the slowest fixed share. Several jobs may
+// be in flight (concurrent publishers, publishes from inside callbacks);
+// a thread waiting for its own job never picks up someone else's, so
+// nested fan-outs cannot deadlock.
+// ============================================================
+class EventDispatchPool
+{
+public:
+    static constexpr unsigned MAX_WORKERS = 8;
+
+    EventDispatchPool() = default;
+    ~EventDispatchPool();
+
+    EventDispatchPool(const EventDispatchPool&) = delete;
+    EventDispatchPool& operator=(const EventDispatchPool&) = delete;
+
+    // Start `workers` threads (clamped to 1..MAX_WORKERS). No-op if already running.
+    void Start(unsigned workers);
+
+    // Join the workers; jobs still in flight finish on their callers' threads
+    void Stop();
+
+    bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+
+    // Runs inline when the pool is not running. `body` must not throw.
+    template <typename F>
+    void ParallelFor(size_t count, F&& body)
+    {
+        Job job;
+        job.context = &body;
+        job.invoke = [](void* ctx, size_t index) { (*static_cast<std::remove_reference_t<F>*>(ctx))(index); };
+        job.count = count;
+        Run(job);
+    }
+
+private:
+    struct Job
+    {
+        void* context = nullptr;
+        void (*invoke)(void*, size_t) = nullptr;
+        size_t count = 0;
+        std::atomic<size_t> next{ 0 }; // next unclaimed index
+        std::atomic<size_t> done{ 0 }; // indices finished
+    };
+
+    void Run(Job& job);
+
+    // Run `index` and keep claiming from the same job; never touches `job`
+    // after its last index is marked done (the owner may have returned)
+    void Work(Job& job, size_t index);
+
+    void WorkerThread();
+
+    std::mutex mutex_;
+    std::condition_variable workCV_; // workers: a job was posted
+    std::condition_variable doneCV_; // owners: a job finished
+    std::deque<Job*> jobs_;          // jobs with unclaimed indices (guarded by mutex_)
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{ false };
+    bool stopping_ = false;
+};
@@ -0,0 +1,436 @@
+#include "EventJournal.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "journal needs lock-free 64-bit atomics in shared memory");
+
+namespace
+{
+constexpr char JOURNAL_MAGIC[8] = { 'A', 'X', 'J', 'R', 'N', 'L', '1', '\0' };
+constexpr size_t HEADER_BYTES = 4096;
+
+uint64_t Align8(uint64_t v) { return (v + 7) & ~uint64_t(7); }
+
+// Journal whose Read() is running on this thread. Close() waits for readers to
+// leave, which the reader itself never does while inside its own callback.
+thread_local const EventJournal* t_readingJournal = nullptr;
+} // namespace
+
+struct EventJournal::FileHeader
+{
+    char magic[8];
+    uint64_t capacity;
+    uint64_t indexBlocks;
+    std::atomic<uint64_t> cursor; // total bytes ever reserved
+};
+
+struct EventJournal::IndexEntry
+{
+    std::atomic<uint64_t> tag; // record offset | 1, 0 = unused
+    std::atomic<int64_t> timestampNs;
+};
+
+// Records are 8-byte aligned, so the tag word never straddles the ring end.
+// tag == offset | 1 marks a committed record at that absolute offset; a stale
+// record from an earlier lap carries a different offset and is rejected.
+struct EventJournal::RecordHeader
+{
+    uint64_t tag;
+    uint32_t length; // header + payload, aligned to 8
+    uint32_t size;   // payload bytes
+    uint64_t eventId;
+    uint64_t sender;
+    int64_t timestampNs;
+};
+
+EventJournal::~EventJournal()
+{
+    Close();
+}
+
+// ============================================================
+// Open / Close
+// ============================================================
+bool EventJournal::Open(const char* path, size_t capacityBytes)
+{
+    if (t_readingJournal == this)
+    {
+        fprintf(stderr, "[EventJournal] Open called from inside a Read callback; ignored.\n");
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(openMutex_);
+    CloseLocked();
+    closeDeferred_.store(false, std::memory_order_relaxed);
+
+    uint64_t capacity = (static_cast<uint64_t>(capacityBytes) + INDEX_BLOCK - 1) / INDEX_BLOCK * INDEX_BLOCK;
+    capacity = (std::max)(capacity, static_cast<uint64_t>(4 * INDEX_BLOCK));
+    uint64_t indexBlocks = capacity / INDEX_BLOCK;
+    size_t total = static_cast<size_t>(HEADER_BYTES + indexBlocks * sizeof(IndexEntry) + capacity);
+
+    void* view = nullptr;
+    bool sameSize = false;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        fprintf(stderr, "[EventJournal] Cannot open '%s' (error %lu).\n", path, GetLastError());
+        return false;
+    }
+    LARGE_INTEGER existing{};
+    GetFileSizeEx(file, &existing);
+    sameSize = static_cast<uint64_t>(existing.QuadPart) == total;
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<uint64_t>(total) >> 32), static_cast<DWORD>(total & 0xFFFFFFFFu), nullptr);
+    if (mapping)
+        view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, total);
+    if (!view)
+    {
+        fprintf(stderr, "[EventJournal] Cannot map '%s' (error %lu).\n", path, GetLastError());
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    file_ = file;
+    mapping_ = mapping;
+#else
+    int fd = ::open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "[EventJournal] Cannot open '%s'.\n", path);
+        return false;
+    }
+    struct stat st{};
+    fstat(fd, &st);
+    sameSize = static_cast<uint64_t>(st.st_size) == total;
+    if (!sameSize && ftruncate(fd, static_cast<off_t>(total)) != 0)
+    {
+        fprintf(stderr, "[EventJournal] Cannot resize '%s'.\n", path);
+        ::close(fd);
+        return false;
+    }
+    view = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        fprintf(stderr, "[EventJournal] Cannot map '%s'.\n", path);
+        ::close(fd);
+        return false;
+    }
+    fd_ = fd;
+#endif
+
+    mappedSize_ = total;
+    capacity_ = capacity;
+    indexBlocks_ = indexBlocks;
+    char* base = static_cast<char*>(view);
+    header_ = reinterpret_cast<FileHeader*>(base);
+    index_ = reinterpret_cast<IndexEntry*>(base + HEADER_BYTES);
+    data_ = base + HEADER_BYTES + indexBlocks * sizeof(IndexEntry);
+
+    // Continue an existing journal only if it was written with the same geometry
+    bool reuse = sameSize && memcmp(header_->magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) == 0 && header_->capacity == capacity && header_->indexBlocks == indexBlocks;
+    if (!reuse)
+    {
+        memset(base, 0, total);
+        header_ = new (base) FileHeader{};
+        header_->capacity = capacity;
+        header_->indexBlocks = indexBlocks;
+        for (uint64_t i = 0; i < indexBlocks; ++i)
+            new (&index_[i]) IndexEntry{};
+        memcpy(header_->magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    }
+    else
+        RecoverTail();
+
+    open_.store(true, std::memory_order_seq_cst);
+    return true;
+}
+
+void EventJournal::Close()
+{
+    if (t_readingJournal == this)
+    {
+        closeDeferred_.store(true, std::memory_order_relaxed);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(openMutex_);
+    CloseLocked();
+}
+
+void EventJournal::CloseLocked()
+{
+    if (!open_.exchange(false, std::memory_order_seq_cst))
+        return;
+    while (active_.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+    Unmap();
+}
+
+void EventJournal::Unmap()
+{
+#ifdef _WIN32
+    if (header_)
+        UnmapViewOfFile(header_);
+    if (mapping_)
+        CloseHandle(static_cast<HANDLE>(mapping_));
+    if (file_)
+        CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    if (header_)
+        munmap(header_, mappedSize_);
+    if (fd_ >= 0)
+        ::close(fd_);
+    fd_ = -1;
+#endif
+    header_ = nullptr;
+    index_ = nullptr;
+    data_ = nullptr;
+    mappedSize_ = 0;
+}
+
+void EventJournal::RecoverTail()
+{
+    uint64_t end = header_->cursor.load(std::memory_order_relaxed);
+    uint64_t oldest = end > capacity_ ? end - capacity_ : 0;
+
+    // Walk from the oldest record boundary still in the ring, the same place
+    // Read starts: concurrent appenders can leave a torn record behind
+    // committed ones, and Read stops at the first gap
+    uint64_t pos = oldest == 0 ? 0 : UINT64_MAX;
+    for (uint64_t i = 0; i < indexBlocks_ && oldest != 0; ++i)
+    {
+        uint64_t tag = index_[i].tag.load(std::memory_order_relaxed);
+        uint64_t offset = tag & ~uint64_t(1);
+        if ((tag & 1) && offset >= oldest && offset < end)
+            pos = (std::min)(pos, offset);
+    }
+    if (pos == UINT64_MAX)
+        return; // nothing verifiable left in the ring
+
+    while (pos < end)
+    {
+        if (TagAt(pos).load(std::memory_order_relaxed) != (pos | 1))
+            break;
+        RecordHeader rec;
+        CopyOut(pos, &rec, sizeof(rec));
+        if (rec.length < sizeof(RecordHeader) || rec.length > capacity_ / 4 || rec.size > rec.length - sizeof(RecordHeader) || pos + rec.length > end)
+            break;
+        pos += rec.length;
+    }
+    if (pos >= end)
+        return;
+
+    // Later appends reuse the space; index entries pointing into it would no
+    // longer land on a record boundary
+    fprintf(stderr, "[EventJournal] Dropped %llu bytes of uncommitted records after an unclean shutdown.\n", static_cast<unsigned long long>(end - pos));
+    for (uint64_t i = 0; i < indexBlocks_; ++i)
+    {
+        uint64_t tag = index_[i].tag.load(std::memory_order_relaxed);
+        if ((tag & 1) && (tag & ~uint64_t(1)) >= pos)
+            index_[i].tag.store(0, std::memory_order_relaxed);
+    }
+    header_->cursor.store(pos, std::memory_order_relaxed);
+}
+
+bool EventJournal::Enter()
+{
+    active_.fetch_add(1, std::memory_order_seq_cst);
+    if (!open_.load(std::memory_order_seq_cst))
+    {
+        Leave();
+        return false;
+    }
+    return true;
+}
+
+// ============================================================
+// Tracked eventIds - fixed open-addressed set, lock-free lookups
+// ============================================================
+bool EventJournal::Track(uint64_t eventId)
+{
+    if (eventId == 0)
+        return false;
+    for (size_t i = 0; i < MAX_TRACKED_EVENTS; ++i)
+    {
+        auto& slot = tracked_[(eventId + i) % MAX_TRACKED_EVENTS];
+        uint64_t current = slot.load(std::memory_order_acquire);
+        if (current == 0 && slot.compare_exchange_strong(current, eventId, std::memory_order_acq_rel))
+        {
+            trackedCount_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        if (current == eventId)
+            return true;
+    }
+    return false;
+}
+
+bool EventJournal::IsTracked(uint64_t eventId) const
+{
+    for (size_t i = 0; i < MAX_TRACKED_EVENTS; ++i)
+    {
+        uint64_t current = tracked_[(eventId + i) % MAX_TRACKED_EVENTS].load(std::memory_order_acquire);
+        if (current == eventId)
+            return true;
+        if (current == 0)
+            return false;
+    }
+    return false;
+}
+
+// ============================================================
+// Ring access (absolute offsets wrap modulo capacity_)
+// ============================================================
+void EventJournal::CopyIn(uint64_t pos, const void* src, size_t size)
+{
+    size_t offset = static_cast<size_t>(pos % capacity_);
+    size_t first = (std::min)(size, static_cast<size_t>(capacity_) - offset);
+    memcpy(data_ + offset, src, first);
+    if (first < size)
+        memcpy(data_, static_cast<const char*>(src) + first, size - first);
+}
+
+void EventJournal::CopyOut(uint64_t pos, void* dst, size_t size) const
+{
+    size_t offset = static_cast<size_t>(pos % capacity_);
+    size_t first = (std::min)(size, static_cast<size_t>(capacity_) - offset);
+    memcpy(dst, data_ + offset, first);
+    if (first < size)
+        memcpy(static_cast<char*>(dst) + first, data_, size - first);
+}
+
+std::atomic<uint64_t>& EventJournal::TagAt(uint64_t pos) const
+{
+    return *reinterpret_cast<std::atomic<uint64_t>*>(data_ + pos % capacity_);
+}
+
+// ============================================================
+// Append - reserve, copy, index, commit
+// ============================================================
+void EventJournal::Append(uint64_t eventId, uint64_t sender, int64_t timestampNs, const char* data, size_t size)
+{
+    uint64_t length = Align8(sizeof(RecordHeader) + size);
+    if (!Enter())
+        return;
+    if (length > capacity_ / 4)
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        Leave();
+        return;
+    }
+
+    uint64_t pos = header_->cursor.fetch_add(length, std::memory_order_relaxed);
+
+    RecordHeader rec{ 0, static_cast<uint32_t>(length), static_cast<uint32_t>(size), eventId, sender, timestampNs };
+    CopyIn(pos + sizeof(uint64_t), reinterpret_cast<const char*>(&rec) + sizeof(uint64_t), sizeof(RecordHeader) - sizeof(uint64_t));
+    if (size)
+        CopyIn(pos + sizeof(RecordHeader), data, size);
+
+    // Index every block boundary this record covers: a record starting on the
+    // boundary indexes itself, one crossing it indexes the record after it
+    for (uint64_t boundary = (pos + INDEX_BLOCK - 1) / INDEX_BLOCK * INDEX_BLOCK; boundary < pos + length; boundary += INDEX_BLOCK)
+    {
+        uint64_t start = (boundary == pos) ? pos : pos + length;
+        IndexEntry& entry = index_[(boundary / INDEX_BLOCK) % indexBlocks_];
+        entry.timestampNs.store(timestampNs, std::memory_order_relaxed);
+        entry.tag.store(start | 1, std::memory_order_release);
+    }
+
+    TagAt(pos).store(pos | 1, std::memory_order_release);
+    Leave();
+}
+
+// ============================================================
+// Read - seek with the index, then walk records (seqlock-style checks)
+// ============================================================
+size_t EventJournal::Read(int64_t fromNs, int64_t toNs, const std::function<void(const RecordView&)>& visit)
+{
+    if (!Enter())
+        return 0;
+
+    const EventJournal* outer = t_readingJournal;
+    t_readingJournal = this;
+    size_t visited = ReadPinned(fromNs, toNs, visit);
+    t_readingJournal = outer;
+    Leave();
+
+    if (outer != this && closeDeferred_.exchange(false, std::memory_order_relaxed))
+        Close();
+    return visited;
+}
+
+size_t EventJournal::ReadPinned(int64_t fromNs, int64_t toNs, const std::function<void(const RecordView&)>& visit)
+{
+    uint64_t end = header_->cursor.load(std::memory_order_acquire);
+    uint64_t oldest = end > capacity_ ? end - capacity_ : 0;
+
+    // Start at the first record boundary still in the ring, or later if the index
+    // shows an entry stamped before the window
+    bool wrapped = oldest != 0;
+    uint64_t earliest = wrapped ? UINT64_MAX : 0;
+    uint64_t seek = 0;
+    for (uint64_t i = 0; i < indexBlocks_; ++i)
+    {
+        uint64_t tag = index_[i].tag.load(std::memory_order_acquire);
+        if (!(tag & 1))
+            continue;
+        uint64_t offset = tag & ~uint64_t(1);
+        if (offset < oldest || offset >= end)
+            continue;
+        earliest = (std::min)(earliest, offset);
+        if (index_[i].timestampNs.load(std::memory_order_relaxed) < fromNs)
+            seek = (std::max)(seek, offset);
+    }
+    if (earliest == UINT64_MAX)
+        return 0;
+    uint64_t pos = (std::max)(earliest, seek);
+
+    size_t visited = 0;
+    std::vector<char> buffer;
+    while (pos < end)
+    {
+        if (TagAt(pos).load(std::memory_order_acquire) != (pos | 1))
+            break; // still being written (or lost to a lap)
+
+        RecordHeader rec;
+        CopyOut(pos, &rec, sizeof(rec));
+        if (rec.length < sizeof(RecordHeader) || rec.length > capacity_ / 4 || rec.size > rec.length - sizeof(RecordHeader))
+            break;
+        bool inWindow = rec.timestampNs >= fromNs && rec.timestampNs <= toNs;
+        if (inWindow)
+        {
+            buffer.resize(rec.size);
+            if (rec.size)
+                CopyOut(pos + sizeof(RecordHeader), buffer.data(), rec.size);
+        }
+        // Seqlock check: a producer on the next lap may have overwritten what we copied
+        if (header_->cursor.load(std::memory_order_acquire) > pos + capacity_)
+        {
+            fprintf(stderr, "[EventJournal] Journal wrapped during read; replay stopped early.\n");
+            break;
+        }
+        if (inWindow)
+        {
+            visit({ rec.eventId, rec.sender, rec.timestampNs, buffer.data(), rec.size });
+            ++visited;
+            if (closeDeferred_.load(std::memory_order_relaxed))
+                break; // closed from the callback
+        }
+        pos += rec.length;
+    }
+    return visited;
+}
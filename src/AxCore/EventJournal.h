@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+// ============================================================
+// EventJournal - memory-mapped ring of serialized events
+//
+// File layout: [4 KB header][time index][data ring]. Producers reserve
+// space with one fetch_add on the shared cursor, copy the record in and
+// publish it by storing its tag last, so appends never take a lock.
+// Every INDEX_BLOCK bytes of the ring get an index entry {record offset,
+// timestamp} that lets a reader seek to a time window without scanning
+// the whole ring. The mapping is shared with the OS page cache, so
+// records survive a process crash and can be replayed after restart.
+// ============================================================
+class EventJournal
+{
+public:
+    // One record as seen by Read(); `data` is only valid during the callback
+    struct RecordView
+    {
+        uint64_t eventId;
+        uint64_t sender;
+        int64_t timestampNs; // system_clock, since epoch
+        const char* data;
+        size_t size;
+    };
+
+    static constexpr size_t INDEX_BLOCK = 64 * 1024;
+    static constexpr size_t MAX_TRACKED_EVENTS = 256;
+
+    EventJournal() = default;
+    ~EventJournal();
+
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    // Map `path`, creating it if needed. An existing journal with the same
+    // capacity is continued (minus a record torn by a crash); anything else
+    // is reinitialized. Fails when called from inside this journal's Read callback.
+    bool Open(const char* path, size_t capacityBytes);
+
+    // Unmap; waits for in-flight appends and reads to finish. Called from inside
+    // a Read callback it cannot wait for that Read, so the close is deferred
+    // until the outermost Read on this thread returns; that Read stops early.
+    void Close();
+
+    bool IsOpen() const { return open_.load(std::memory_order_acquire); }
+
+    // Opt an eventId into recording. Insert-only; false when the table is full.
+    bool Track(uint64_t eventId);
+    bool IsTracked(uint64_t eventId) const;
+    bool HasTracked() const { return trackedCount_.load(std::memory_order_relaxed) != 0; }
+
+    // Append one record (lock-free). Records larger than a quarter of the ring are dropped.
+    void Append(uint64_t eventId, uint64_t sender, int64_t timestampNs, const char* data, size_t size);
+
+    // Visit committed records with fromNs <= timestamp <= toNs in journal order.
+    // Stops early at a record still being written or overwritten during the read.
+    // `visit` may call Close() (deferred, see above) but not Open().
+    size_t Read(int64_t fromNs, int64_t toNs, const std::function<void(const RecordView&)>& visit);
+
+    uint64_t DroppedCount() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct FileHeader;
+    struct IndexEntry;
+    struct RecordHeader;
+
+    // Pins the mapping for the duration of an append/read; false if closed
+    bool Enter();
+    void Leave() { active_.fetch_sub(1, std::memory_order_release); }
+
+    void CloseLocked();
+
+    // Read() body; runs with the mapping pinned
+    size_t ReadPinned(int64_t fromNs, int64_t toNs, const std::function<void(const RecordView&)>& visit);
+
+    // Open on an existing journal: cut the cursor back to the end of the last
+    // committed record, dropping a record torn by a crash mid-append
+    void RecoverTail();
+
+    void CopyIn(uint64_t pos, const void* src, size_t size);
+    void CopyOut(uint64_t pos, void* dst, size_t size) const;
+    std::atomic<uint64_t>& TagAt(uint64_t pos) const;
+    void Unmap();
+
+    FileHeader* header_ = nullptr;
+    IndexEntry* index_ = nullptr;
+    char* data_ = nullptr;
+    uint64_t capacity_ = 0;
+    uint64_t indexBlocks_ = 0;
+    size_t mappedSize_ = 0;
+#ifdef _WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+
+    std::mutex openMutex_; // serializes Open/Close
+    std::atomic<bool> open_{ false };
+    std::atomic<uint32_t> active_{ 0 };
+    std::atomic<bool> closeDeferred_{ false }; // Close() came from a Read callback
+    std::atomic<uint64_t> dropped_{ 0 };
+
+    // Open-addressed set of tracked eventIds; 0 marks an empty slot
+    std::atomic<uint64_t> tracked_[MAX_TRACKED_EVENTS] = {};
+    std::atomic<uint32_t> trackedCount_{ 0 };
+};
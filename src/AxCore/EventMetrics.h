@@ -0,0 +1,119 @@
+#pragma once
+
+#include "AxPlug/AxEventBus.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// ============================================================
+// LatencyHistogram - lock-free log-bucketed latency histogram (nanoseconds)
+//
+// Each power of two is split into 8 linear sub-buckets, so any recorded
+// value lands in a bucket at most 12.5% wide. Recording is one relaxed
+// fetch_add (plus a rarely-taken CAS for the max); readers sum the buckets
+// without stopping writers, so a snapshot is approximate but never torn
+// per bucket. Values above ~73 minutes fall into the last bucket.
+// ============================================================
+class LatencyHistogram
+{
+public:
+    static constexpr int SUB_BITS = 3;
+    static constexpr uint64_t SUB_COUNT = 1ull << SUB_BITS;
+    static constexpr int MAX_MSB = 41;
+    static constexpr size_t BUCKETS = SUB_COUNT + (MAX_MSB - SUB_BITS + 1) * SUB_COUNT;
+
+    void Record(uint64_t ns)
+    {
+        buckets_[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        uint64_t prev = max_.load(std::memory_order_relaxed);
+        while (ns > prev && !max_.compare_exchange_weak(prev, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    AxPlug::LatencyStats Snapshot() const
+    {
+        uint64_t counts[BUCKETS];
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKETS; ++i)
+        {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        AxPlug::LatencyStats stats;
+        stats.count = total;
+        stats.maxNs = max_.load(std::memory_order_relaxed);
+        if (total == 0)
+            return stats;
+
+        // Report each percentile as its bucket's upper bound, capped by the observed max
+        auto percentile = [&](uint64_t permille) {
+            uint64_t rank = (total * permille + 999) / 1000;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKETS; ++i)
+            {
+                seen += counts[i];
+                if (seen >= rank)
+                    return (std::min)(UpperBound(i), stats.maxNs);
+            }
+            return stats.maxNs;
+        };
+        stats.p50Ns = percentile(500);
+        stats.p99Ns = percentile(990);
+        stats.p999Ns = percentile(999);
+        return stats;
+    }
+
+private:
+    static int Log2Floor(uint64_t v)
+    {
+        int msb = 0;
+        for (int shift = 32; shift > 0; shift >>= 1)
+        {
+            if (v >> shift)
+            {
+                v >>= shift;
+                msb += shift;
+            }
+        }
+        return msb;
+    }
+
+    static size_t BucketOf(uint64_t v)
+    {
+        if (v < SUB_COUNT)
+            return static_cast<size_t>(v);
+        int msb = Log2Floor(v);
+        if (msb > MAX_MSB)
+            return BUCKETS - 1;
+        uint64_t sub = (v >> (msb - SUB_BITS)) & (SUB_COUNT - 1);
+        return static_cast<size_t>(SUB_COUNT + (msb - SUB_BITS) * SUB_COUNT + sub);
+    }
+
+    static uint64_t UpperBound(size_t index)
+    {
+        if (index < SUB_COUNT)
+            return index;
+        int msb = static_cast<int>((index - SUB_COUNT) / SUB_COUNT) + SUB_BITS;
+        uint64_t sub = (index - SUB_COUNT) % SUB_COUNT;
+        uint64_t width = 1ull << (msb - SUB_BITS);
+        return ((SUB_COUNT + sub) << (msb - SUB_BITS)) + width - 1;
+    }
+
+    std::atomic<uint64_t> buckets_[BUCKETS] = {};
+    std::atomic<uint64_t> max_{ 0 };
+};
+
+// ============================================================
+// EventMetrics - always-on counters for one eventId
+// ============================================================
+struct EventMetrics
+{
+    std::atomic<uint64_t> publishes{ 0 };  // payloads published
+    std::atomic<uint64_t> deliveries{ 0 }; // callbacks run + mailbox posts accepted
+    std::atomic<uint64_t> drops{ 0 };      // mailbox posts rejected (inbox full)
+    LatencyHistogram callbackNs;          // per-callback run time (bus-side callbacks)
+    LatencyHistogram queueWaitNs;         // Queued: enqueue -> dequeue
+};
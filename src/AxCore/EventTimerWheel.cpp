@@ -0,0 +1,83 @@
+#include "EventTimerWheel.h"
+
+EventTimerWheel::EventTimerWheel()
+    : start_(Clock::now())
+{
+}
+
+uint64_t EventTimerWheel::NowTick() const
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_).count());
+}
+
+// ============================================================
+// Add - never fires early: the deadline is rounded up past the current tick
+// ============================================================
+void EventTimerWheel::Add(TaskPtr task, Clock::time_point due)
+{
+    auto offsetUs = std::chrono::duration_cast<std::chrono::microseconds>(due - start_).count();
+    uint64_t deadline = offsetUs <= 0 ? 0 : static_cast<uint64_t>((offsetUs + 999) / 1000);
+    task->deadline = (std::max)(deadline, currentTick_ + 1);
+    Place(std::move(task));
+}
+
+// ============================================================
+// Place - pick the coarsest level still needed to reach the deadline
+// ============================================================
+void EventTimerWheel::Place(TaskPtr task)
+{
+    uint64_t delta = task->deadline > currentTick_ ? task->deadline - currentTick_ : 0;
+    if (delta > MAX_DELTA)
+    {
+        delta = MAX_DELTA;
+        task->deadline = currentTick_ + MAX_DELTA;
+    }
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (1ull << (SLOT_BITS * (level + 1))))
+        ++level;
+
+    uint64_t deadline = (std::max)(task->deadline, currentTick_);
+    slots_[level][(deadline >> (SLOT_BITS * level)) & SLOT_MASK].push_back(std::move(task));
+    ++count_;
+}
+
+// ============================================================
+// Cascade - coarse levels first, so a level-2 slot can refill the
+// level-1 slot that is cascaded right after it on the same tick
+// ============================================================
+void EventTimerWheel::Cascade()
+{
+    for (int level = LEVELS - 1; level >= 1; --level)
+    {
+        uint64_t windowMask = (1ull << (SLOT_BITS * level)) - 1;
+        if ((currentTick_ & windowMask) != 0)
+            continue;
+
+        auto& slot = slots_[level][(currentTick_ >> (SLOT_BITS * level)) & SLOT_MASK];
+        if (slot.empty())
+            continue;
+        std::vector<TaskPtr> tasks;
+        tasks.swap(slot);
+        for (auto& task : tasks)
+        {
+            --count_;
+            if (task->connection.IsActive())
+                Place(std::move(task));
+        }
+    }
+}
+
+// ============================================================
+// NextWakeTime - next occupied level-0 slot, or the next cascade point
+// ============================================================
+EventTimerWheel::Clock::time_point EventTimerWheel::NextWakeTime() const
+{
+    uint64_t tick = currentTick_ + 1;
+    for (; (tick & SLOT_MASK) != 0; ++tick)
+    {
+        if (!slots_[0][tick & SLOT_MASK].empty())
+            break;
+    }
+    return start_ + std::chrono::milliseconds(static_cast<int64_t>(tick));
+}
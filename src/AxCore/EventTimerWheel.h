@@ -0,0 +1,121 @@
+#pragma once
+
+#include "AxPlug/AxEventBus.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// ============================================================
+// EventTimerWheel - hierarchical timer wheel driven by the bus event loop
+//
+// 4 levels x 256 slots at 1 ms resolution (~49 days of range). Adding a
+// timer and advancing one tick are O(1); tasks are cascaded to the finer
+// level when their coarse slot comes up. Cancellation is lazy: a
+// disconnected task is dropped the next time the wheel reaches it.
+// Not thread-safe: only the event loop thread touches the wheel.
+// ============================================================
+class EventTimerWheel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Task
+    {
+        AxPlug::EventConnection connection; // Disconnect() cancels
+        AxPlug::InlineFunction<void()> fn;
+        uint64_t deadline = 0; // absolute tick
+        uint64_t period = 0;   // ticks between runs, 0 = one-shot
+    };
+    using TaskPtr = std::shared_ptr<Task>;
+
+    EventTimerWheel();
+
+    // Schedule a task to first run at `due` (rounded up to whole ticks, never early)
+    void Add(TaskPtr task, Clock::time_point due);
+
+    // Run every task due up to now. Exceptions from tasks are routed to onError.
+    template <typename OnError>
+    void Advance(OnError&& onError)
+    {
+        uint64_t target = NowTick();
+        if (count_ == 0)
+        {
+            currentTick_ = (std::max)(currentTick_, target);
+            return;
+        }
+        while (currentTick_ < target)
+        {
+            if (count_ == 0)
+            {
+                currentTick_ = target;
+                break;
+            }
+            ++currentTick_;
+            Cascade();
+            RunSlot(onError);
+        }
+    }
+
+    bool Empty() const { return count_ == 0; }
+
+    // Latest time the loop may sleep until without missing a deadline
+    Clock::time_point NextWakeTime() const;
+
+    // 1 tick = 1 ms
+    static uint64_t ToTicks(std::chrono::milliseconds ms) { return ms.count() <= 0 ? 0 : static_cast<uint64_t>(ms.count()); }
+
+private:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 8;
+    static constexpr uint64_t SLOTS = 1ull << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+    static constexpr uint64_t MAX_DELTA = (1ull << (SLOT_BITS * LEVELS)) - 1;
+
+    uint64_t NowTick() const;
+
+    // Put a task in the slot matching its deadline relative to currentTick_
+    void Place(TaskPtr task);
+
+    // Re-place the coarse slots whose window starts at currentTick_
+    void Cascade();
+
+    template <typename OnError>
+    void RunSlot(OnError& onError)
+    {
+        auto& slot = slots_[0][currentTick_ & SLOT_MASK];
+        if (slot.empty())
+            return;
+        std::vector<TaskPtr> due;
+        due.swap(slot);
+        for (auto& task : due)
+        {
+            --count_;
+            if (!task->connection.IsActive())
+                continue;
+            try {
+                task->fn();
+            } catch (const std::exception& e) {
+                onError(e);
+            } catch (...) {
+                static std::runtime_error unknownErr("[EventBus] Unknown non-std::exception caught in timer task.");
+                onError(unknownErr);
+            }
+            if (task->period != 0 && task->connection.IsActive())
+            {
+                // Skip missed periods instead of firing a burst after a stall
+                task->deadline += task->period;
+                if (task->deadline <= currentTick_)
+                    task->deadline = currentTick_ + task->period;
+                Place(std::move(task));
+            }
+        }
+    }
+
+    std::vector<TaskPtr> slots_[LEVELS][SLOTS];
+    uint64_t currentTick_ = 0;
+    size_t count_ = 0;
+    Clock::time_point start_;
+};
@@ -1,4 +1,5 @@
 #include "NetworkEventBusImpl.h"
+#include <algorithm>
 #include <cstring>
 #include <cstdio>
 #include <chrono>
@@ -9,6 +10,7 @@
 #include <ws2tcpip.h>
 #else
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <unistd.h>
@@ -45,17 +47,178 @@ static uint32_t ReadU32LE(const uint8_t* buf)
     return val;
 }
 
+static void WriteU16LE(uint8_t* buf, uint16_t val)
+{
+    buf[0] = static_cast<uint8_t>(val & 0xFF);
+    buf[1] = static_cast<uint8_t>(val >> 8);
+}
+
+static uint16_t ReadU16LE(const uint8_t* buf)
+{
+    return static_cast<uint16_t>(buf[0] | (buf[1] << 8));
+}
+
+static int64_t SteadyNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static size_t InterestHome(uint64_t eventId, size_t slots)
+{
+    return static_cast<size_t>((eventId ^ (eventId >> 31)) * 0xC2B2AE3D27D4EB4Full) & (slots - 1);
+}
+
+static sockaddr_in MakeGroupAddr(const std::string& group, int port)
+{
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    inet_pton(AF_INET, group.c_str(), &addr.sin_addr);
+    return addr;
+}
+
 // ============================================================
 // EventBusProxy - delegates to NetworkEventBusImpl
 // ============================================================
-void EventBusProxy::Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode)
+void EventBusProxy::Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    owner_->ProxyPublish(eventId, std::move(payload), mode, priority);
+}
+
+void EventBusProxy::PublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    owner_->ProxyPublishBatch(eventId, payloads, count, mode, priority);
+}
+
+AxPlug::EventConnectionPtr EventBusProxy::Subscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender)
+{
+    return owner_->ProxySubscribe(eventId, std::move(handler), specificSender);
+}
+
+AxPlug::EventConnectionPtr EventBusProxy::SubscribeOn(uint64_t eventId, AxPlug::EventMailboxPtr mailbox, AxPlug::EventHandler handler, void* specificSender)
+{
+    // Mailbox subscriptions live on the local bus, like all subscriptions
+    if (!owner_->localBus_) return nullptr;
+    auto conn = owner_->localBus_->SubscribeOn(eventId, std::move(mailbox), std::move(handler), specificSender);
+    owner_->MarkInterestChanged();
+    return conn;
+}
+
+std::vector<AxPlug::EventConnectionPtr> EventBusProxy::SubscribeBulk(std::vector<AxPlug::SubscriptionRequest> requests)
 {
-    owner_->ProxyPublish(eventId, std::move(payload), mode);
+    if (!owner_->localBus_) return {};
+    auto conns = owner_->localBus_->SubscribeBulk(std::move(requests));
+    owner_->MarkInterestChanged();
+    return conns;
 }
 
-AxPlug::EventConnectionPtr EventBusProxy::Subscribe(uint64_t eventId, AxPlug::EventCallback callback, void* specificSender)
+// Topic registry lives on the local bus. Remote events only match patterns
+// for topics this process has registered itself.
+uint64_t EventBusProxy::RegisterTopic(const char* name)
 {
-    return owner_->ProxySubscribe(eventId, std::move(callback), specificSender);
+    if (!owner_->localBus_) return AxPlug::HashEventId(name);
+    uint64_t eventId = owner_->localBus_->RegisterTopic(name);
+    owner_->MarkInterestChanged(); // existing pattern subscribers attach to it
+    return eventId;
+}
+
+AxPlug::EventConnectionPtr EventBusProxy::SubscribePattern(const char* pattern, AxPlug::EventHandler handler, void* specificSender)
+{
+    if (!owner_->localBus_) return nullptr;
+    auto conn = owner_->localBus_->SubscribePattern(pattern, std::move(handler), specificSender);
+    owner_->MarkInterestChanged();
+    return conn;
+}
+
+// Tasks run on the local bus's event loop
+AxPlug::EventConnectionPtr EventBusProxy::ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, AxPlug::InlineFunction<void()> task)
+{
+    if (owner_->localBus_) return owner_->localBus_->ScheduleTask(delay, period, std::move(task));
+    return nullptr;
+}
+
+void EventBusProxy::SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes)
+{
+    if (owner_->localBus_) owner_->localBus_->SetSlowSubscriberPolicy(budget, strikes);
+}
+
+// Requests and replies are matched by the local bus; the request itself is
+// published locally only (a correlationId means nothing to another process)
+uint64_t EventBusProxy::RequestAsync(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, std::chrono::milliseconds timeout, AxPlug::ReplyHandler onReply, AxPlug::DispatchMode mode)
+{
+    if (owner_->localBus_) return owner_->localBus_->RequestAsync(eventId, std::move(payload), timeout, std::move(onReply), mode);
+    if (onReply) onReply(nullptr);
+    return 0;
+}
+
+bool EventBusProxy::Reply(const AxPlug::AxEvent& request, std::shared_ptr<AxPlug::AxEvent> reply)
+{
+    return owner_->localBus_ && owner_->localBus_->Reply(request, std::move(reply));
+}
+
+// The journal records on the local bus, so it sees both local publishes and
+// events received from the network. Replay is local-only (never rebroadcast).
+bool EventBusProxy::OpenJournal(const char* path, size_t capacityBytes)
+{
+    return owner_->localBus_ && owner_->localBus_->OpenJournal(path, capacityBytes);
+}
+
+void EventBusProxy::CloseJournal()
+{
+    if (owner_->localBus_) owner_->localBus_->CloseJournal();
+}
+
+bool EventBusProxy::JournalEvent(uint64_t eventId, AxPlug::JournalEventFactory factory)
+{
+    return owner_->localBus_ && owner_->localBus_->JournalEvent(eventId, std::move(factory));
+}
+
+size_t EventBusProxy::ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, AxPlug::DispatchMode mode)
+{
+    return owner_->localBus_ ? owner_->localBus_->ReplayJournal(from, to, mode) : 0;
+}
+
+// Timers run on the local bus's event loop; timed events are delivered locally only
+AxPlug::EventConnectionPtr EventBusProxy::PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority)
+{
+    if (owner_->localBus_) return owner_->localBus_->PublishAfter(delay, eventId, std::move(payload), priority);
+    return nullptr;
+}
+
+AxPlug::EventConnectionPtr EventBusProxy::PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority)
+{
+    if (owner_->localBus_) return owner_->localBus_->PublishEvery(period, eventId, std::move(payload), priority);
+    return nullptr;
+}
+
+// Parallel fan-out only applies to local subscribers
+bool EventBusProxy::SetParallelDispatch(uint64_t eventId, bool enabled)
+{
+    return owner_->localBus_ && owner_->localBus_->SetParallelDispatch(eventId, enabled);
+}
+
+// Remote events are re-published on the local bus, so they become sticky there too
+bool EventBusProxy::SetSticky(uint64_t eventId, bool enabled)
+{
+    return owner_->localBus_ && owner_->localBus_->SetSticky(eventId, enabled);
+}
+
+// Metrics are collected by the local bus
+bool EventBusProxy::GetEventStats(uint64_t eventId, AxPlug::EventStats& stats)
+{
+    if (owner_->localBus_) return owner_->localBus_->GetEventStats(eventId, stats);
+    return false;
+}
+
+std::vector<AxPlug::EventStats> EventBusProxy::GetAllEventStats()
+{
+    if (owner_->localBus_) return owner_->localBus_->GetAllEventStats();
+    return {};
+}
+
+bool EventBusProxy::GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts)
+{
+    return owner_->localBus_ && owner_->localBus_->GetSubscriberCounts(eventIds, count, counts);
 }
 
 void EventBusProxy::SetExceptionHandler(AxPlug::ExceptionHandler handler)
@@ -172,6 +335,10 @@ bool NetworkEventBusImpl::StartNetwork(const char* multicastGroup, int port)
         return false;
     }
 
+    // Room for a burst of fragments while the receiver thread catches up
+    int rcvBuf = RECV_BUFFER_BYTES;
+    setsockopt(static_cast<SOCKET>(recvSocket_), SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&rcvBuf), sizeof(rcvBuf));
+
     // Set recv timeout so thread can check running_ flag periodically
     DWORD timeout = 500; // 500ms
     setsockopt(static_cast<SOCKET>(recvSocket_), SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
@@ -212,13 +379,19 @@ bool NetworkEventBusImpl::StartNetwork(const char* multicastGroup, int port)
         return false;
     }
 
+    int rcvBuf = RECV_BUFFER_BYTES;
+    setsockopt(recvSocket_, SOL_SOCKET, SO_RCVBUF, &rcvBuf, sizeof(rcvBuf));
+
     struct timeval tv;
     tv.tv_sec = 0; tv.tv_usec = 500000;
     setsockopt(recvSocket_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
 #endif
 
+    // Peers answer the first advert with theirs; until then nothing is filtered
+    interestGraceUntilNs_.store(SteadyNowNs() + INTEREST_GRACE_MS * 1000000, std::memory_order_relaxed);
     networkRunning_.store(true, std::memory_order_release);
     receiverThread_ = std::thread(&NetworkEventBusImpl::ReceiverThread, this);
+    senderThread_ = std::thread(&NetworkEventBusImpl::SenderThread, this);
 
     fprintf(stderr, "[NetworkEventBus] Started on %s:%d (nodeId=0x%llx)\n", multicastGroup, port, static_cast<unsigned long long>(nodeId_));
     return true;
@@ -233,6 +406,14 @@ void NetworkEventBusImpl::StopNetwork()
     if (receiverThread_.joinable())
         receiverThread_.join();
 
+    // The sender thread sends what is still pending before the sockets close
+    {
+        std::lock_guard<std::mutex> lock(batchMutex_);
+        batchCV_.notify_all();
+    }
+    if (senderThread_.joinable())
+        senderThread_.join();
+
 #ifdef _WIN32
     if (sendSocket_ != INVALID_SOCKET) { closesocket(static_cast<SOCKET>(sendSocket_)); sendSocket_ = INVALID_SOCKET; }
     if (recvSocket_ != INVALID_SOCKET) { closesocket(static_cast<SOCKET>(recvSocket_)); recvSocket_ = INVALID_SOCKET; }
@@ -249,8 +430,11 @@ bool NetworkEventBusImpl::IsNetworkActive() const
 
 void NetworkEventBusImpl::RegisterNetworkableEvent(uint64_t eventId, AxPlug::NetworkEventFactory factory)
 {
-    std::lock_guard<std::mutex> lock(factoryMutex_);
-    factoryRegistry_[eventId] = std::move(factory);
+    {
+        std::lock_guard<std::mutex> lock(factoryMutex_);
+        factoryRegistry_[eventId] = std::move(factory);
+    }
+    MarkInterestChanged();
 }
 
 AxPlug::IEventBus* NetworkEventBusImpl::AsEventBus()
@@ -258,6 +442,66 @@ AxPlug::IEventBus* NetworkEventBusImpl::AsEventBus()
     return proxy_.get();
 }
 
+AxPlug::NetworkTransportStats NetworkEventBusImpl::GetTransportStats() const
+{
+    AxPlug::NetworkTransportStats stats;
+    stats.fragmentedSent = counters_.fragmentedSent.load(std::memory_order_relaxed);
+    stats.fragmentsSent = counters_.fragmentsSent.load(std::memory_order_relaxed);
+    stats.fragmentsReceived = counters_.fragmentsReceived.load(std::memory_order_relaxed);
+    stats.reassembled = counters_.reassembled.load(std::memory_order_relaxed);
+    stats.reassemblyTimeouts = counters_.reassemblyTimeouts.load(std::memory_order_relaxed);
+    stats.reassemblyDrops = counters_.reassemblyDrops.load(std::memory_order_relaxed);
+    stats.oversizeDrops = counters_.oversizeDrops.load(std::memory_order_relaxed);
+    stats.batchesSent = counters_.batchesSent.load(std::memory_order_relaxed);
+    stats.batchedEvents = counters_.batchedEvents.load(std::memory_order_relaxed);
+    stats.naksSent = counters_.naksSent.load(std::memory_order_relaxed);
+    stats.retransmits = counters_.retransmits.load(std::memory_order_relaxed);
+    stats.datagramsRecovered = counters_.datagramsRecovered.load(std::memory_order_relaxed);
+    stats.datagramsLost = counters_.datagramsLost.load(std::memory_order_relaxed);
+    stats.duplicatesDropped = counters_.duplicatesDropped.load(std::memory_order_relaxed);
+    stats.interestAdverts = counters_.interestAdverts.load(std::memory_order_relaxed);
+    for (const EventSlot& slot : eventSlots_)
+    {
+        stats.throttled += slot.throttled.load(std::memory_order_relaxed);
+        stats.uninterestedSkipped += slot.uninterested.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void NetworkEventBusImpl::SetBatching(size_t datagramBytes, std::chrono::microseconds maxDelay)
+{
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    FlushBatchLocked(); // pending events were sized for the old budget
+    if (datagramBytes != 0)
+        datagramBytes = (std::max)(HEADER_SIZE + BATCH_RECORD_HEADER_SIZE + 1, (std::min)(datagramBytes, MAX_PACKET_SIZE));
+    batchDelay_ = maxDelay;
+    batchBudget_.store(datagramBytes, std::memory_order_relaxed);
+}
+
+void NetworkEventBusImpl::SetReliableDelivery(size_t retransmitBytes)
+{
+    std::lock_guard<std::mutex> lock(reliableMutex_);
+    retransmitLimit_ = retransmitBytes;
+    if (retransmitBytes == 0)
+    {
+        // Sequence numbers continue if it is turned on again, so receivers see no gap
+        reliable_.store(false, std::memory_order_relaxed);
+        std::vector<RetransmitSlot>().swap(retransmitRing_);
+        retainedBytes_ = 0;
+        oldestSeq_ = nextSeq_;
+        return;
+    }
+    if (retransmitRing_.empty())
+        retransmitRing_.resize(RETRANSMIT_SLOTS);
+    TrimRetainedLocked();
+    reliable_.store(true, std::memory_order_relaxed);
+}
+
+void NetworkEventBusImpl::SetInterestFiltering(bool enabled)
+{
+    interestFiltering_.store(enabled, std::memory_order_relaxed);
+}
+
 uint64_t NetworkEventBusImpl::GetNodeId() const
 {
     return nodeId_;
@@ -266,55 +510,188 @@ uint64_t NetworkEventBusImpl::GetNodeId() const
 // ============================================================
 // Proxy Publish: local dispatch + network broadcast
 // ============================================================
-void NetworkEventBusImpl::ProxyPublish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode)
+void NetworkEventBusImpl::ProxyPublish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
 {
     // Step 1: Always dispatch locally first via the original bus
     if (localBus_)
     {
-        localBus_->Publish(eventId, payload, mode);
+        localBus_->Publish(eventId, payload, mode, priority);
     }
 
-    // Step 2: Anti-storm filter — only INetworkableEvent subtypes go over network + rate limiting
+    // Step 2: Anti-storm filter — only INetworkableEvent subtypes go over network,
+    // only if some peer wants the eventId, + rate limiting
     if (networkRunning_.load(std::memory_order_acquire))
     {
         auto netEvent = std::dynamic_pointer_cast<AxPlug::INetworkableEvent>(payload);
-        if (netEvent && CheckRateLimit(eventId))
+        if (netEvent && AdmitBroadcast(eventId))
         {
             BroadcastToNetwork(eventId, netEvent);
         }
     }
 }
 
-AxPlug::EventConnectionPtr NetworkEventBusImpl::ProxySubscribe(uint64_t eventId, AxPlug::EventCallback callback, void* specificSender)
+void NetworkEventBusImpl::ProxyPublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    // Local batch keeps the single-snapshot / single-wakeup fast path
+    if (localBus_)
+    {
+        localBus_->PublishBatch(eventId, payloads, count, mode, priority);
+    }
+
+    if (networkRunning_.load(std::memory_order_acquire))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto netEvent = std::dynamic_pointer_cast<AxPlug::INetworkableEvent>(payloads[i]);
+            if (netEvent && AdmitBroadcast(eventId))
+            {
+                BroadcastToNetwork(eventId, netEvent);
+            }
+        }
+    }
+}
+
+AxPlug::EventConnectionPtr NetworkEventBusImpl::ProxySubscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender)
 {
     // Subscribe always goes to the local bus
     if (localBus_)
     {
-        return localBus_->Subscribe(eventId, std::move(callback), specificSender);
+        auto conn = localBus_->Subscribe(eventId, std::move(handler), specificSender);
+        MarkInterestChanged();
+        return conn;
     }
     return nullptr;
 }
 
 // ============================================================
-// CheckRateLimit - anti-storm: throttle per eventId per time window
+// Admission - remote interest + lock-free token bucket per eventId (GCRA)
 // ============================================================
-bool NetworkEventBusImpl::CheckRateLimit(uint64_t eventId)
+NetworkEventBusImpl::EventSlot* NetworkEventBusImpl::FindEventSlot(uint64_t eventId)
 {
-    auto now = std::chrono::steady_clock::now();
-    std::lock_guard<std::mutex> lock(rateLimitMutex_);
-    auto& rl = rateLimitMap_[eventId];
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - rl.windowStart).count();
-    if (elapsed >= RATE_LIMIT_WINDOW_MS)
+    if (eventId == 0)
+        return nullptr;
+    size_t index = static_cast<size_t>((eventId ^ (eventId >> 29)) * 0x9E3779B97F4A7C15ull) & (EVENT_SLOTS - 1);
+    for (size_t probe = 0; probe < EVENT_SLOTS; ++probe, index = (index + 1) & (EVENT_SLOTS - 1))
     {
-        rl.windowStart = now;
-        rl.count = 1;
+        EventSlot& bucket = eventSlots_[index];
+        uint64_t owner = bucket.eventId.load(std::memory_order_acquire);
+        if (owner == eventId)
+            return &bucket;
+        if (owner == 0)
+        {
+            if (bucket.eventId.compare_exchange_strong(owner, eventId, std::memory_order_acq_rel) || owner == eventId)
+                return &bucket;
+        }
+    }
+    return nullptr;
+}
+
+bool NetworkEventBusImpl::AdmitBroadcast(uint64_t eventId)
+{
+    EventSlot* slot = FindEventSlot(eventId);
+    if (!slot)
+        return true; // table full: better unlimited than silently dropped
+    const int64_t now = SteadyNowNs();
+
+    // Checked first so events nobody wants do not use up tokens
+    if (interestFiltering_.load(std::memory_order_relaxed)
+        && now >= interestGraceUntilNs_.load(std::memory_order_relaxed)
+        && !PeerInterested(eventId, now))
+    {
+        slot->uninterested.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return CheckRateLimit(*slot, now);
+}
+
+// Remote interest table: written only by the receiver thread. Entries are never
+// emptied (probe chains stay intact); an expired one is reassigned instead.
+bool NetworkEventBusImpl::PeerInterested(uint64_t eventId, int64_t now) const
+{
+    size_t index = InterestHome(eventId, INTEREST_SLOTS);
+    for (size_t probe = 0; probe < INTEREST_SLOTS; ++probe, index = (index + 1) & (INTEREST_SLOTS - 1))
+    {
+        const InterestSlot& slot = interestSlots_[index];
+        const uint64_t owner = slot.eventId.load(std::memory_order_acquire);
+        if (owner == eventId)
+            return now < slot.untilNs.load(std::memory_order_relaxed);
+        if (owner == 0)
+            break;
+    }
+    // Unknown: wanted only while the table is too full to record every advert
+    return now < interestOverflowUntilNs_.load(std::memory_order_relaxed);
+}
+
+void NetworkEventBusImpl::RecordInterest(uint64_t eventId, int64_t now, int64_t until)
+{
+    if (eventId == 0)
+        return;
+    InterestSlot* target = nullptr;
+    InterestSlot* expired = nullptr;
+    size_t index = InterestHome(eventId, INTEREST_SLOTS);
+    for (size_t probe = 0; probe < INTEREST_SLOTS; ++probe, index = (index + 1) & (INTEREST_SLOTS - 1))
+    {
+        InterestSlot& slot = interestSlots_[index];
+        const uint64_t owner = slot.eventId.load(std::memory_order_relaxed);
+        if (owner == eventId)
+        {
+            slot.untilNs.store(until, std::memory_order_relaxed);
+            return;
+        }
+        if (owner == 0)
+        {
+            target = &slot;
+            break;
+        }
+        if (!expired && slot.untilNs.load(std::memory_order_relaxed) <= now)
+            expired = &slot;
+    }
+    if (expired)
+        target = expired;
+    if (!target)
+    {
+        interestOverflowUntilNs_.store(until, std::memory_order_relaxed);
+        return;
+    }
+    target->untilNs.store(until, std::memory_order_relaxed);
+    target->eventId.store(eventId, std::memory_order_release);
+}
+
+bool NetworkEventBusImpl::CheckRateLimit(EventSlot& bucket, int64_t now)
+{
+    const int64_t interval = bucket.intervalNs.load(std::memory_order_relaxed);
+    if (interval == 0)
         return true;
+    const int64_t tolerance = bucket.toleranceNs.load(std::memory_order_relaxed);
+
+    // Conforming while the next arrival time is no more than `burst - 1` intervals ahead
+    int64_t tat = bucket.tat.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        const int64_t start = (std::max)(tat, now);
+        if (start - now > tolerance)
+        {
+            bucket.throttled.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (bucket.tat.compare_exchange_weak(tat, start + interval, std::memory_order_relaxed))
+            return true;
     }
-    if (rl.count >= RATE_LIMIT_MAX)
+}
+
+bool NetworkEventBusImpl::SetRateLimit(uint64_t eventId, double eventsPerSecond, uint32_t burst)
+{
+    EventSlot* bucket = FindEventSlot(eventId);
+    if (!bucket)
     {
-        return false; // throttled
+        fprintf(stderr, "[NetworkEventBus] WARNING: rate limit table full (%zu event IDs), 0x%llx not limited\n", EVENT_SLOTS, static_cast<unsigned long long>(eventId));
+        return false;
     }
-    ++rl.count;
+    int64_t interval = 0;
+    if (eventsPerSecond > 0)
+        interval = (std::max)(static_cast<int64_t>(1e9 / eventsPerSecond), static_cast<int64_t>(1));
+    bucket->intervalNs.store(interval, std::memory_order_relaxed);
+    bucket->toleranceNs.store(static_cast<int64_t>((std::max)(burst, 1u) - 1) * interval, std::memory_order_relaxed);
     return true;
 }
 
@@ -323,91 +700,884 @@ bool NetworkEventBusImpl::CheckRateLimit(uint64_t eventId)
 // ============================================================
 void NetworkEventBusImpl::BroadcastToNetwork(uint64_t eventId, const std::shared_ptr<AxPlug::INetworkableEvent>& evt)
 {
+    // Byte-slice payloads are sent straight from their buffer
+    if (auto* buffer = dynamic_cast<const AxPlug::AxBufferEvent*>(evt.get()))
+    {
+        SendDatagram(eventId, buffer->bytes.data(), buffer->bytes.size());
+        return;
+    }
+
+    // Span-serializable events are written into a per-thread buffer that is reused
+    thread_local std::vector<uint8_t> scratch;
+    size_t size = 0;
+    if (evt->SerializeInto(scratch, size))
+    {
+        SendDatagram(eventId, scratch.data(), size);
+        if (scratch.capacity() > SCRATCH_KEEP_BYTES)
+            std::vector<uint8_t>().swap(scratch);
+        return;
+    }
+
     std::string serialized = evt->Serialize();
-    size_t totalSize = HEADER_SIZE + serialized.size();
+    SendDatagram(eventId, serialized.data(), serialized.size());
+}
+
+void NetworkEventBusImpl::SendDatagram(uint64_t eventId, const void* payload, size_t size)
+{
+    if (batchBudget_.load(std::memory_order_relaxed) != 0 && AppendToBatch(eventId, payload, size))
+        return;
 
-    if (totalSize > MAX_PACKET_SIZE)
+    uint8_t header[HEADER_SIZE + FRAGMENT_HEADER_SIZE];
+    WriteU64LE(header, eventId);
+    WriteU64LE(header + 8, nodeId_);
+
+    if (HEADER_SIZE + size <= MAX_PACKET_SIZE)
     {
-        fprintf(stderr, "[NetworkEventBus] Event 0x%llx payload too large (%zu bytes), skipping\n", static_cast<unsigned long long>(eventId), serialized.size());
+        WriteU32LE(header + 16, static_cast<uint32_t>(size));
+        SendParts(header, HEADER_SIZE, payload, size);
         return;
     }
 
-    std::vector<uint8_t> packet(totalSize);
-    WriteU64LE(packet.data(), eventId);
-    WriteU64LE(packet.data() + 8, nodeId_);
-    WriteU32LE(packet.data() + 16, static_cast<uint32_t>(serialized.size()));
-    if (!serialized.empty())
+    if (size > MAX_MESSAGE_SIZE)
     {
-        memcpy(packet.data() + HEADER_SIZE, serialized.data(), serialized.size());
+        counters_.oversizeDrops.fetch_add(1, std::memory_order_relaxed);
+        fprintf(stderr, "[NetworkEventBus] Event 0x%llx payload too large (%zu bytes, limit %zu), skipping\n", static_cast<unsigned long long>(eventId), size, MAX_MESSAGE_SIZE);
+        return;
     }
 
-    sockaddr_in destAddr{};
-    destAddr.sin_family = AF_INET;
-    destAddr.sin_port = htons(static_cast<uint16_t>(multicastPort_));
-    inet_pton(AF_INET, multicastGroup_.c_str(), &destAddr.sin_addr);
+    // Fragment: every piece repeats the event header and adds (messageId, index, count, totalSize).
+    // Headers for up to SEND_BATCH pieces are built on the stack and sent together.
+    const uint32_t messageId = nextMessageId_.fetch_add(1, std::memory_order_relaxed);
+    const size_t count = (size + FRAGMENT_PAYLOAD_SIZE - 1) / FRAGMENT_PAYLOAD_SIZE;
+    const auto* bytes = static_cast<const uint8_t*>(payload);
+    WriteU32LE(header + HEADER_SIZE, messageId);
+    WriteU16LE(header + HEADER_SIZE + 6, static_cast<uint16_t>(count));
+    WriteU32LE(header + HEADER_SIZE + 8, static_cast<uint32_t>(size));
+
+    uint8_t headers[SEND_BATCH][sizeof(header)];
+    OutgoingPart parts[SEND_BATCH];
+    size_t pending = 0;
+    for (size_t index = 0; index < count; ++index)
+    {
+        const size_t offset = index * FRAGMENT_PAYLOAD_SIZE;
+        const size_t length = (std::min)(FRAGMENT_PAYLOAD_SIZE, size - offset);
+        uint8_t* fragmentHeader = headers[pending];
+        memcpy(fragmentHeader, header, sizeof(header));
+        WriteU32LE(fragmentHeader + 16, FRAGMENT_FLAG | static_cast<uint32_t>(FRAGMENT_HEADER_SIZE + length));
+        WriteU16LE(fragmentHeader + HEADER_SIZE + 4, static_cast<uint16_t>(index));
+        parts[pending++] = OutgoingPart{ fragmentHeader, sizeof(header), bytes + offset, length };
+        if (pending == SEND_BATCH || index + 1 == count)
+        {
+            SendPartsBatch(parts, pending);
+            pending = 0;
+        }
+    }
+    counters_.fragmentedSent.fetch_add(1, std::memory_order_relaxed);
+    counters_.fragmentsSent.fetch_add(count, std::memory_order_relaxed);
+}
+
+void NetworkEventBusImpl::SendParts(const uint8_t* header, size_t headerSize, const void* payload, size_t size)
+{
+    const OutgoingPart part{ header, headerSize, payload, size };
+    SendPartsBatch(&part, 1);
+}
+
+void NetworkEventBusImpl::SendPartsBatch(const OutgoingPart* parts, size_t count)
+{
+    if (!reliable_.load(std::memory_order_relaxed))
+    {
+        WriteParts(parts, count);
+        return;
+    }
+
+    // Reliable: every datagram goes out inside a sequenced copy kept for NAKs
+    std::lock_guard<std::mutex> lock(reliableMutex_);
+    OutgoingPart wrapped[SEND_BATCH];
+    while (count > 0)
+    {
+        const size_t chunk = (std::min)(count, SEND_BATCH);
+        for (size_t i = 0; i < chunk; ++i)
+            wrapped[i] = RetainLocked(parts[i]);
+        WriteParts(wrapped, chunk);
+        TrimRetainedLocked(); // only after the write: the chunk points into the ring
+        parts += chunk;
+        count -= chunk;
+    }
+}
 
+void NetworkEventBusImpl::WriteParts(const OutgoingPart* parts, size_t count)
+{
+    sockaddr_in destAddr = MakeGroupAddr(multicastGroup_, multicastPort_);
+
+#if defined(__linux__)
+    iovec iov[SEND_BATCH][2];
+    mmsghdr msgs[SEND_BATCH];
+    while (count > 0)
+    {
+        const size_t chunk = (std::min)(count, SEND_BATCH);
+        for (size_t i = 0; i < chunk; ++i)
+        {
+            iov[i][0].iov_base = const_cast<uint8_t*>(parts[i].header);
+            iov[i][0].iov_len = parts[i].headerSize;
+            iov[i][1].iov_base = const_cast<void*>(parts[i].payload);
+            iov[i][1].iov_len = parts[i].size;
+            msgs[i] = mmsghdr{};
+            msgs[i].msg_hdr.msg_name = &destAddr;
+            msgs[i].msg_hdr.msg_namelen = sizeof(destAddr);
+            msgs[i].msg_hdr.msg_iov = iov[i];
+            msgs[i].msg_hdr.msg_iovlen = parts[i].size ? 2 : 1;
+        }
+        // sendmmsg may stop early; resend the rest, give up on an error like sendto would
+        const int sent = sendmmsg(sendSocket_, msgs, static_cast<unsigned int>(chunk), 0);
+        if (sent <= 0)
+            return;
+        parts += sent;
+        count -= static_cast<size_t>(sent);
+    }
+#else
+    for (size_t i = 0; i < count; ++i)
+    {
+        const OutgoingPart& part = parts[i];
 #ifdef _WIN32
-    sendto(static_cast<SOCKET>(sendSocket_), reinterpret_cast<const char*>(packet.data()), static_cast<int>(totalSize), 0, reinterpret_cast<sockaddr*>(&destAddr), sizeof(destAddr));
+        WSABUF bufs[2];
+        bufs[0].buf = const_cast<char*>(reinterpret_cast<const char*>(part.header));
+        bufs[0].len = static_cast<ULONG>(part.headerSize);
+        bufs[1].buf = const_cast<char*>(static_cast<const char*>(part.payload));
+        bufs[1].len = static_cast<ULONG>(part.size);
+        DWORD sent = 0;
+        WSASendTo(static_cast<SOCKET>(sendSocket_), bufs, part.size ? 2 : 1, &sent, 0, reinterpret_cast<sockaddr*>(&destAddr), sizeof(destAddr), nullptr, nullptr);
 #else
-    sendto(sendSocket_, packet.data(), totalSize, 0, reinterpret_cast<sockaddr*>(&destAddr), sizeof(destAddr));
+        iovec iov[2];
+        iov[0].iov_base = const_cast<uint8_t*>(part.header);
+        iov[0].iov_len = part.headerSize;
+        iov[1].iov_base = const_cast<void*>(part.payload);
+        iov[1].iov_len = part.size;
+        msghdr msg{};
+        msg.msg_name = &destAddr;
+        msg.msg_namelen = sizeof(destAddr);
+        msg.msg_iov = iov;
+        msg.msg_iovlen = part.size ? 2 : 1;
+        sendmsg(sendSocket_, &msg, 0);
+#endif
+    }
 #endif
 }
 
+// ============================================================
+// Reliable delivery - sender side
+// ============================================================
+NetworkEventBusImpl::OutgoingPart NetworkEventBusImpl::RetainLocked(const OutgoingPart& part)
+{
+    const uint64_t seq = nextSeq_++;
+    RetransmitSlot& slot = retransmitRing_[seq % RETRANSMIT_SLOTS];
+    if (seq >= RETRANSMIT_SLOTS && oldestSeq_ <= seq - RETRANSMIT_SLOTS)
+        oldestSeq_ = seq - RETRANSMIT_SLOTS + 1; // the slot's previous datagram is overwritten
+
+    // Reuse the slot's capacity: steady-state sends do not allocate
+    retainedBytes_ -= slot.bytes.capacity();
+    const size_t innerSize = part.headerSize + part.size;
+    slot.bytes.resize(HEADER_SIZE + innerSize);
+    uint8_t* data = slot.bytes.data();
+    WriteU64LE(data, seq);
+    WriteU64LE(data + 8, nodeId_);
+    WriteU32LE(data + 16, RELIABLE_FLAG | static_cast<uint32_t>(innerSize));
+    memcpy(data + HEADER_SIZE, part.header, part.headerSize);
+    if (part.size)
+        memcpy(data + HEADER_SIZE + part.headerSize, part.payload, part.size);
+    retainedBytes_ += slot.bytes.capacity();
+    slot.seq = seq;
+    slot.retransmittedAt = std::chrono::steady_clock::time_point();
+    return OutgoingPart{ data, slot.bytes.size(), nullptr, 0 };
+}
+
+void NetworkEventBusImpl::TrimRetainedLocked()
+{
+    // Over the byte budget: release the oldest copies (always keep the newest)
+    while (retainedBytes_ > retransmitLimit_ && oldestSeq_ + 1 < nextSeq_)
+    {
+        RetransmitSlot& slot = retransmitRing_[oldestSeq_ % RETRANSMIT_SLOTS];
+        if (slot.seq == oldestSeq_)
+        {
+            retainedBytes_ -= slot.bytes.capacity();
+            std::vector<uint8_t>().swap(slot.bytes);
+            slot.seq = 0;
+        }
+        ++oldestSeq_;
+    }
+}
+
+void NetworkEventBusImpl::OnNak(uint64_t firstSeq, uint32_t count)
+{
+    std::lock_guard<std::mutex> lock(reliableMutex_);
+    if (!reliable_.load(std::memory_order_relaxed))
+        return;
+
+    const auto now = std::chrono::steady_clock::now();
+    const uint64_t lastSeq = firstSeq + (std::min)(static_cast<size_t>(count), RETRANSMIT_SLOTS);
+    bool gone = false;
+    OutgoingPart parts[SEND_BATCH];
+    size_t pending = 0;
+    for (uint64_t seq = firstSeq; seq < lastSeq && seq < nextSeq_; ++seq)
+    {
+        RetransmitSlot& slot = retransmitRing_[seq % RETRANSMIT_SLOTS];
+        if (seq < oldestSeq_ || slot.seq != seq)
+        {
+            gone = true;
+            continue;
+        }
+        // Several receivers usually NAK the same loss: resend it once per interval
+        if (now - slot.retransmittedAt < std::chrono::milliseconds(NAK_INTERVAL_MS / 2))
+            continue;
+        slot.retransmittedAt = now;
+        parts[pending++] = OutgoingPart{ slot.bytes.data(), slot.bytes.size(), nullptr, 0 };
+        if (pending == SEND_BATCH)
+        {
+            WriteParts(parts, pending);
+            counters_.retransmits.fetch_add(pending, std::memory_order_relaxed);
+            pending = 0;
+        }
+    }
+    if (pending)
+    {
+        WriteParts(parts, pending);
+        counters_.retransmits.fetch_add(pending, std::memory_order_relaxed);
+    }
+
+    // Tell receivers where retention starts so they stop waiting for the rest
+    if (gone)
+        SendHeartbeatLocked();
+}
+
+void NetworkEventBusImpl::SendHeartbeat(bool force)
+{
+    std::lock_guard<std::mutex> lock(reliableMutex_);
+    if (!reliable_.load(std::memory_order_relaxed) || nextSeq_ == 1)
+        return;
+    if (heartbeatSeq_ != nextSeq_ - 1)
+        heartbeatRepeats_ = 0;
+    else if (!force && heartbeatRepeats_ >= HEARTBEAT_REPEATS)
+        return; // idle: receivers already know the tail
+    SendHeartbeatLocked();
+    ++heartbeatRepeats_;
+}
+
+void NetworkEventBusImpl::SendHeartbeatLocked()
+{
+    uint8_t packet[HEADER_SIZE + HEARTBEAT_SIZE];
+    WriteU64LE(packet, CONTROL_HEARTBEAT);
+    WriteU64LE(packet + 8, nodeId_);
+    WriteU32LE(packet + 16, CONTROL_FLAG | static_cast<uint32_t>(HEARTBEAT_SIZE));
+    WriteU64LE(packet + HEADER_SIZE, nextSeq_ - 1);
+    WriteU64LE(packet + HEADER_SIZE + 8, oldestSeq_);
+    const OutgoingPart part{ packet, sizeof(packet), nullptr, 0 };
+    WriteParts(&part, 1);
+    heartbeatSeq_ = nextSeq_ - 1;
+}
+
+// ============================================================
+// Batching - coalesce small events into one datagram
+// ============================================================
+bool NetworkEventBusImpl::AppendToBatch(uint64_t eventId, const void* payload, size_t size)
+{
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    const size_t budget = batchBudget_.load(std::memory_order_relaxed);
+    const size_t recordSize = BATCH_RECORD_HEADER_SIZE + size;
+    if (budget == 0 || HEADER_SIZE + recordSize > budget)
+    {
+        FlushBatchLocked(); // keep this sender's order: pending small events go first
+        return false;
+    }
+    if (batchBuffer_.size() + recordSize > budget)
+        FlushBatchLocked();
+
+    if (batchRecords_ == 0)
+    {
+        batchBuffer_.resize(HEADER_SIZE);
+        WriteU64LE(batchBuffer_.data(), 0);
+        WriteU64LE(batchBuffer_.data() + 8, nodeId_);
+        batchDeadline_ = std::chrono::steady_clock::now() + batchDelay_;
+        batchCV_.notify_one();
+    }
+    const size_t at = batchBuffer_.size();
+    batchBuffer_.resize(at + recordSize);
+    WriteU64LE(batchBuffer_.data() + at, eventId);
+    WriteU32LE(batchBuffer_.data() + at + 8, static_cast<uint32_t>(size));
+    if (size)
+        memcpy(batchBuffer_.data() + at + BATCH_RECORD_HEADER_SIZE, payload, size);
+    ++batchRecords_;
+
+    // No room for even an empty record: send now rather than wait for the deadline
+    if (batchBuffer_.size() + BATCH_RECORD_HEADER_SIZE >= budget)
+        FlushBatchLocked();
+    return true;
+}
+
+void NetworkEventBusImpl::FlushBatchLocked()
+{
+    if (batchRecords_ == 0)
+        return;
+    WriteU32LE(batchBuffer_.data() + 16, BATCH_FLAG | static_cast<uint32_t>(batchBuffer_.size() - HEADER_SIZE));
+    SendParts(batchBuffer_.data(), batchBuffer_.size(), nullptr, 0);
+    counters_.batchesSent.fetch_add(1, std::memory_order_relaxed);
+    counters_.batchedEvents.fetch_add(batchRecords_, std::memory_order_relaxed);
+    batchBuffer_.clear();
+    batchRecords_ = 0;
+}
+
+void NetworkEventBusImpl::SenderThread()
+{
+    std::unique_lock<std::mutex> lock(batchMutex_);
+    auto nextHeartbeat = std::chrono::steady_clock::now();
+    auto nextInterest = nextHeartbeat;
+    bool query = true; // the first advert asks peers for theirs
+    while (networkRunning_.load(std::memory_order_acquire))
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (batchRecords_ != 0 && now >= batchDeadline_)
+        {
+            FlushBatchLocked();
+            continue;
+        }
+        if (now >= nextHeartbeat)
+        {
+            SendHeartbeat(false);
+            nextHeartbeat = now + std::chrono::milliseconds(HEARTBEAT_INTERVAL_MS);
+        }
+        if (interestChanged_.exchange(false, std::memory_order_acq_rel) || now >= nextInterest)
+        {
+            // Reads the factory table and the local bus: not under batchMutex_
+            lock.unlock();
+            SendInterest(query);
+            lock.lock();
+            query = false;
+            nextInterest = now + std::chrono::milliseconds(INTEREST_INTERVAL_MS);
+            continue;
+        }
+        const auto wake = (std::min)(nextHeartbeat, nextInterest);
+        batchCV_.wait_until(lock, batchRecords_ != 0 ? (std::min)(batchDeadline_, wake) : wake);
+    }
+    FlushBatchLocked();
+    SendHeartbeat(true);
+}
+
+// ============================================================
+// Remote interest - advertise what this node subscribes to, remember
+// what peers advertised
+// ============================================================
+void NetworkEventBusImpl::MarkInterestChanged()
+{
+    if (!networkRunning_.load(std::memory_order_acquire))
+        return; // StartNetwork advertises the current set anyway
+    interestChanged_.store(true, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    batchCV_.notify_all();
+}
+
+void NetworkEventBusImpl::SendInterest(bool query)
+{
+    std::vector<uint64_t> ids;
+    {
+        std::lock_guard<std::mutex> lock(factoryMutex_);
+        ids.reserve(factoryRegistry_.size());
+        for (const auto& kv : factoryRegistry_)
+            ids.push_back(kv.first);
+    }
+    // Registered and subscribed. Pattern subscribers are counted on the topics
+    // they attached to. A local bus that does not track subscribers (the
+    // IEventBus default) cannot tell, so there every registered eventId is kept.
+    if (localBus_ && !ids.empty())
+    {
+        std::vector<size_t> counts(ids.size());
+        if (localBus_->GetSubscriberCounts(ids.data(), ids.size(), counts.data()))
+        {
+            size_t kept = 0;
+            for (size_t i = 0; i < ids.size(); ++i)
+            {
+                if (counts[i] != 0)
+                    ids[kept++] = ids[i];
+            }
+            ids.resize(kept);
+        }
+    }
+    if (ids.empty() && !query)
+        return; // nothing to renew; a query goes out even when empty
+
+    std::vector<uint8_t> packet;
+    size_t at = 0;
+    do
+    {
+        const size_t count = (std::min)(ids.size() - at, INTEREST_IDS_PER_DATAGRAM);
+        packet.resize(HEADER_SIZE + 4 + count * 8);
+        WriteU64LE(packet.data(), query ? CONTROL_INTEREST_QUERY : CONTROL_INTEREST);
+        WriteU64LE(packet.data() + 8, nodeId_);
+        WriteU32LE(packet.data() + 16, CONTROL_FLAG | static_cast<uint32_t>(4 + count * 8));
+        WriteU32LE(packet.data() + HEADER_SIZE, static_cast<uint32_t>(count));
+        for (size_t i = 0; i < count; ++i)
+            WriteU64LE(packet.data() + HEADER_SIZE + 4 + i * 8, ids[at + i]);
+        const OutgoingPart part{ packet.data(), packet.size(), nullptr, 0 };
+        WriteParts(&part, 1);
+        counters_.interestAdverts.fetch_add(1, std::memory_order_relaxed);
+        at += count;
+        query = false;
+    } while (at < ids.size());
+}
+
+void NetworkEventBusImpl::OnInterest(const uint8_t* payload, size_t size)
+{
+    if (size < 4)
+        return;
+    const uint32_t count = ReadU32LE(payload);
+    if (count > (size - 4) / 8)
+        return; // Truncated list
+
+    // Renewed by every advert; lapses once the peer stops listing it (unsubscribed / gone)
+    const int64_t now = SteadyNowNs();
+    const int64_t until = now + INTEREST_TIMEOUT_MS * 1000000;
+    for (uint32_t i = 0; i < count; ++i)
+        RecordInterest(ReadU64LE(payload + 4 + i * 8), now, until);
+}
+
 // ============================================================
 // ReceiverThread - listens for UDP multicast and re-publishes locally
 // ============================================================
 void NetworkEventBusImpl::ReceiverThread()
 {
-    std::vector<uint8_t> buffer(MAX_PACKET_SIZE);
+    reassemblies_.clear();
+    reassemblyBytes_ = 0;
+    lastExpiry_ = std::chrono::steady_clock::now();
+    peers_.clear();
+    lastStreamCheck_ = lastExpiry_;
+
+#if defined(__linux__)
+    // A ring of packet buffers filled by one recvmmsg per burst. Buffers are shared
+    // so a received AxBufferEvent can keep referencing one; only such a slot is
+    // replaced, the rest are reused as-is.
+    std::shared_ptr<std::vector<uint8_t>> ring[RECV_BATCH];
+    iovec iov[RECV_BATCH];
+    mmsghdr msgs[RECV_BATCH];
 
     while (networkRunning_.load(std::memory_order_acquire))
     {
+        for (size_t i = 0; i < RECV_BATCH; ++i)
+        {
+            if (!ring[i] || ring[i].use_count() != 1)
+                ring[i] = std::make_shared<std::vector<uint8_t>>(RECV_PACKET_SIZE);
+            iov[i].iov_base = ring[i]->data();
+            iov[i].iov_len = ring[i]->size();
+            msgs[i] = mmsghdr{};
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // Blocks (up to SO_RCVTIMEO) for the first packet, then takes whatever else is queued
+        const int count = recvmmsg(recvSocket_, msgs, static_cast<unsigned int>(RECV_BATCH), MSG_WAITFORONE, nullptr);
+
+        // Partial events and sequence gaps are checked here too, so a quiet network still times them out
+        const auto now = std::chrono::steady_clock::now();
+        if (!reassemblies_.empty())
+            ExpireReassemblies(now);
+        if (!peers_.empty())
+            CheckStreams(now);
+
+        for (int i = 0; i < count; ++i)
+            HandleDatagram(ring[i], ring[i]->data(), msgs[i].msg_len);
+    }
+#else
+    // Shared so a received AxBufferEvent can keep referencing it after we move on
+    auto buffer = std::make_shared<std::vector<uint8_t>>(RECV_PACKET_SIZE);
+
+    while (networkRunning_.load(std::memory_order_acquire))
+    {
+        // Still referenced by a delivered byte slice: receive into a fresh one
+        if (buffer.use_count() != 1)
+            buffer = std::make_shared<std::vector<uint8_t>>(RECV_PACKET_SIZE);
+
         sockaddr_in srcAddr{};
-        int addrLen = sizeof(srcAddr);
 
 #ifdef _WIN32
-        int received = recvfrom(static_cast<SOCKET>(recvSocket_), reinterpret_cast<char*>(buffer.data()), static_cast<int>(buffer.size()), 0, reinterpret_cast<sockaddr*>(&srcAddr), &addrLen);
+        int addrLen = sizeof(srcAddr);
+        int received = recvfrom(static_cast<SOCKET>(recvSocket_), reinterpret_cast<char*>(buffer->data()), static_cast<int>(buffer->size()), 0, reinterpret_cast<sockaddr*>(&srcAddr), &addrLen);
 #else
         socklen_t sAddrLen = sizeof(srcAddr);
-        ssize_t received = recvfrom(recvSocket_, buffer.data(), buffer.size(), 0, reinterpret_cast<sockaddr*>(&srcAddr), &sAddrLen);
+        ssize_t received = recvfrom(recvSocket_, buffer->data(), buffer->size(), 0, reinterpret_cast<sockaddr*>(&srcAddr), &sAddrLen);
 #endif
 
-        if (received < static_cast<int>(HEADER_SIZE))
-            continue; // Timeout or too-small packet
+        // Partial events and sequence gaps are checked here too, so a quiet network still times them out
+        const auto now = std::chrono::steady_clock::now();
+        if (!reassemblies_.empty())
+            ExpireReassemblies(now);
+        if (!peers_.empty())
+            CheckStreams(now);
 
-        uint64_t eventId = ReadU64LE(buffer.data());
-        uint64_t senderNodeId = ReadU64LE(buffer.data() + 8);
-        uint32_t payloadLen = ReadU32LE(buffer.data() + 16);
+        if (received > 0)
+            HandleDatagram(buffer, buffer->data(), static_cast<size_t>(received));
+    }
+#endif
 
-        // Skip packets from ourselves (loopback prevention)
-        if (senderNodeId == nodeId_)
-            continue;
+    reassemblies_.clear();
+    reassemblyBytes_ = 0;
+    peers_.clear();
+}
+
+void NetworkEventBusImpl::HandleDatagram(const std::shared_ptr<std::vector<uint8_t>>& buffer, const uint8_t* data, size_t size)
+{
+    if (size < HEADER_SIZE)
+        return; // Too-small packet
+
+    uint64_t eventId = ReadU64LE(data);
+    uint64_t senderNodeId = ReadU64LE(data + 8);
+    uint32_t payloadLen = ReadU32LE(data + 16);
+
+    // Skip packets from ourselves (loopback prevention)
+    if (senderNodeId == nodeId_)
+        return;
+
+    const uint32_t flags = payloadLen & FLAG_MASK;
+    payloadLen &= ~FLAG_MASK;
+    if (HEADER_SIZE + payloadLen > size)
+        return; // Truncated packet
+
+    if (flags & RELIABLE_FLAG)
+        OnSequenced(eventId, senderNodeId, data + HEADER_SIZE, payloadLen, buffer);
+    else if (flags & CONTROL_FLAG)
+        OnControl(eventId, senderNodeId, data + HEADER_SIZE, payloadLen);
+    else if (flags & BATCH_FLAG)
+    {
+        // Records are small: copy each out instead of pinning the receive buffer
+        const uint8_t* record = data + HEADER_SIZE;
+        const uint8_t* end = record + payloadLen;
+        while (static_cast<size_t>(end - record) >= BATCH_RECORD_HEADER_SIZE)
+        {
+            const uint64_t recordEventId = ReadU64LE(record);
+            const uint32_t recordSize = ReadU32LE(record + 8);
+            record += BATCH_RECORD_HEADER_SIZE;
+            if (recordSize > static_cast<size_t>(end - record))
+                break; // Truncated record
+            PublishRemote(recordEventId, buffer, record, recordSize, false);
+            record += recordSize;
+        }
+    }
+    else if (flags & FRAGMENT_FLAG)
+        OnFragment(eventId, senderNodeId, data + HEADER_SIZE, payloadLen);
+    else
+        PublishRemote(eventId, buffer, data + HEADER_SIZE, payloadLen, payloadLen >= ZERO_COPY_MIN_BYTES);
+}
+
+// ============================================================
+// Reliable delivery - receiver side, receiver thread only
+// ============================================================
+void NetworkEventBusImpl::OnSequenced(uint64_t seq, uint64_t senderNodeId, const uint8_t* inner, size_t size, const std::shared_ptr<std::vector<uint8_t>>& buffer)
+{
+    // The wrapped datagram must be a plain one: no nested sequencing or control
+    if (size < HEADER_SIZE || (ReadU32LE(inner + 16) & (RELIABLE_FLAG | CONTROL_FLAG)) || seq == 0)
+        return;
 
-        if (HEADER_SIZE + payloadLen > static_cast<size_t>(received))
-            continue; // Truncated packet
+    const auto now = std::chrono::steady_clock::now();
+    PeerStream& peer = peers_[senderNodeId];
+    peer.lastHeard = now;
+    if (peer.expected == 0)
+        peer.expected = seq; // joined mid-stream: earlier datagrams are not ours to recover
 
-        // Look up factory for this eventId
-        AxPlug::NetworkEventFactory factory;
+    if (seq < peer.expected || peer.held.count(seq))
+    {
+        counters_.duplicatesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (seq <= peer.highest) // announced by a later datagram or a heartbeat
+        counters_.datagramsRecovered.fetch_add(1, std::memory_order_relaxed);
+    else
+        peer.highest = seq;
+
+    // Past a gap with the hold full: give up on the oldest gaps to make room
+    while (seq > peer.expected && !peer.held.empty() && (peer.held.size() >= MAX_HELD_DATAGRAMS || peer.heldBytes + size > MAX_HELD_BYTES))
+        SkipTo(peer, (std::min)(peer.held.begin()->first, seq));
+
+    if (seq == peer.expected)
+    {
+        ++peer.expected;
+        HandleDatagram(buffer, inner, size);
+        DeliverHeld(peer);
+    }
+    else
+    {
+        // Past a gap: keep a copy (not the receive buffer) until the gap fills
+        peer.held.emplace(seq, std::make_shared<std::vector<uint8_t>>(inner, inner + size));
+        peer.heldBytes += size;
+        if (peer.gapSince == std::chrono::steady_clock::time_point())
         {
-            std::lock_guard<std::mutex> lock(factoryMutex_);
-            auto it = factoryRegistry_.find(eventId);
-            if (it == factoryRegistry_.end())
-                continue; // Unknown event type, skip
-            factory = it->second;
+            peer.gapSince = now;
+            SendNak(senderNodeId, peer, now);
         }
+    }
 
-        // Deserialize
-        auto evt = factory();
-        if (!evt)
+    if (peer.expected > peer.highest)
+        peer.gapSince = std::chrono::steady_clock::time_point();
+}
+
+void NetworkEventBusImpl::OnControl(uint64_t type, uint64_t senderNodeId, const uint8_t* payload, size_t size)
+{
+    if (type == CONTROL_NAK && size >= NAK_SIZE)
+    {
+        if (ReadU64LE(payload) == nodeId_)
+            OnNak(ReadU64LE(payload + 8), ReadU32LE(payload + 16));
+        return;
+    }
+    if (type == CONTROL_INTEREST || type == CONTROL_INTEREST_QUERY)
+    {
+        OnInterest(payload, size);
+        if (type == CONTROL_INTEREST_QUERY)
+            MarkInterestChanged(); // a node just joined: answer now, not at the next interval
+        return;
+    }
+    if (type != CONTROL_HEARTBEAT || size < HEARTBEAT_SIZE)
+        return;
+
+    const uint64_t lastSeq = ReadU64LE(payload);
+    const uint64_t oldestSeq = ReadU64LE(payload + 8);
+    const auto now = std::chrono::steady_clock::now();
+    PeerStream& peer = peers_[senderNodeId];
+    peer.lastHeard = now;
+    if (peer.expected == 0)
+    {
+        peer.expected = lastSeq + 1; // nothing received yet: start after what was already sent
+        peer.highest = lastSeq;
+        return;
+    }
+    if (lastSeq > peer.highest)
+        peer.highest = lastSeq;
+    if (oldestSeq > peer.expected)
+        SkipTo(peer, oldestSeq); // the sender no longer has them
+
+    if (peer.expected > peer.highest)
+        peer.gapSince = std::chrono::steady_clock::time_point();
+    else if (peer.gapSince == std::chrono::steady_clock::time_point())
+    {
+        peer.gapSince = now; // tail loss: only the heartbeat revealed it
+        SendNak(senderNodeId, peer, now);
+    }
+}
+
+void NetworkEventBusImpl::DeliverHeld(PeerStream& peer)
+{
+    while (!peer.held.empty() && peer.held.begin()->first == peer.expected)
+    {
+        auto datagram = std::move(peer.held.begin()->second);
+        peer.held.erase(peer.held.begin());
+        peer.heldBytes -= datagram->size();
+        ++peer.expected;
+        HandleDatagram(datagram, datagram->data(), datagram->size());
+    }
+}
+
+void NetworkEventBusImpl::SkipTo(PeerStream& peer, uint64_t seq)
+{
+    // Everything before `seq` that is not held is lost; held datagrams still go out in order
+    while (peer.expected < seq)
+    {
+        auto next = peer.held.begin();
+        const uint64_t stop = (next != peer.held.end() && next->first < seq) ? next->first : seq;
+        counters_.datagramsLost.fetch_add(stop - peer.expected, std::memory_order_relaxed);
+        peer.expected = stop;
+        DeliverHeld(peer);
+    }
+    DeliverHeld(peer);
+}
+
+void NetworkEventBusImpl::SendNak(uint64_t senderNodeId, PeerStream& peer, std::chrono::steady_clock::time_point now)
+{
+    // The first missing run: up to the first held datagram, or through the advertised tail
+    const uint64_t end = peer.held.empty() ? peer.highest + 1 : peer.held.begin()->first;
+    if (end <= peer.expected)
+        return;
+    const uint64_t count = (std::min)(end - peer.expected, static_cast<uint64_t>(RETRANSMIT_SLOTS));
+
+    uint8_t packet[HEADER_SIZE + NAK_SIZE];
+    WriteU64LE(packet, CONTROL_NAK);
+    WriteU64LE(packet + 8, nodeId_);
+    WriteU32LE(packet + 16, CONTROL_FLAG | static_cast<uint32_t>(NAK_SIZE));
+    WriteU64LE(packet + HEADER_SIZE, senderNodeId);
+    WriteU64LE(packet + HEADER_SIZE + 8, peer.expected);
+    WriteU32LE(packet + HEADER_SIZE + 16, static_cast<uint32_t>(count));
+    const OutgoingPart part{ packet, sizeof(packet), nullptr, 0 };
+    WriteParts(&part, 1);
+    peer.lastNak = now;
+    counters_.naksSent.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NetworkEventBusImpl::CheckStreams(std::chrono::steady_clock::time_point now)
+{
+    if (now - lastStreamCheck_ < std::chrono::milliseconds(NAK_INTERVAL_MS / 2))
+        return;
+    lastStreamCheck_ = now;
+
+    for (auto it = peers_.begin(); it != peers_.end();)
+    {
+        PeerStream& peer = it->second;
+        if (peer.expected != 0 && peer.expected <= peer.highest)
+        {
+            if (peer.gapSince == std::chrono::steady_clock::time_point())
+                peer.gapSince = now;
+            if (now - peer.gapSince >= std::chrono::milliseconds(GAP_TIMEOUT_MS))
+            {
+                // Give up on the first missing run; a later one gets its own timeout
+                SkipTo(peer, peer.held.empty() ? peer.highest + 1 : peer.held.begin()->first);
+                peer.gapSince = peer.expected <= peer.highest ? now : std::chrono::steady_clock::time_point();
+            }
+            else if (now - peer.lastNak >= std::chrono::milliseconds(NAK_INTERVAL_MS))
+                SendNak(it->first, peer, now);
+        }
+        else if (now - peer.lastHeard >= std::chrono::milliseconds(PEER_TIMEOUT_MS))
+        {
+            it = peers_.erase(it);
             continue;
+        }
+        ++it;
+    }
+}
+
+bool NetworkEventBusImpl::HasFactory(uint64_t eventId)
+{
+    std::lock_guard<std::mutex> lock(factoryMutex_);
+    return factoryRegistry_.find(eventId) != factoryRegistry_.end();
+}
+
+void NetworkEventBusImpl::PublishRemote(uint64_t eventId, const std::shared_ptr<std::vector<uint8_t>>& holder, const uint8_t* payload, size_t size, bool zeroCopy)
+{
+    // Look up factory for this eventId
+    AxPlug::NetworkEventFactory factory;
+    {
+        std::lock_guard<std::mutex> lock(factoryMutex_);
+        auto it = factoryRegistry_.find(eventId);
+        if (it == factoryRegistry_.end())
+            return; // Unknown event type, skip
+        factory = it->second;
+    }
+
+    // Deserialize
+    auto evt = factory();
+    if (!evt)
+        return;
 
-        std::string data(reinterpret_cast<const char*>(buffer.data() + HEADER_SIZE), payloadLen);
-        evt->Deserialize(data);
+    if (auto* bufferEvent = dynamic_cast<AxPlug::AxBufferEvent*>(evt.get()))
+    {
+        if (zeroCopy)
+            bufferEvent->bytes = AxPlug::ByteSlice::Wrap(holder, payload, size);
+        else
+            bufferEvent->bytes = AxPlug::ByteSlice::Copy(payload, size);
+    }
+    else
+    {
+        evt->DeserializeFrom(payload, size);
+    }
+
+    // Re-publish locally (NOT through proxy to avoid re-broadcasting)
+    if (localBus_)
+    {
+        localBus_->Publish(eventId, evt, AxPlug::DispatchMode::DirectCall);
+    }
+}
+
+// ============================================================
+// Reassembly - receiver thread only, bounded by count and bytes
+// ============================================================
+void NetworkEventBusImpl::OnFragment(uint64_t eventId, uint64_t senderNodeId, const uint8_t* fragment, size_t size)
+{
+    counters_.fragmentsReceived.fetch_add(1, std::memory_order_relaxed);
+    if (size < FRAGMENT_HEADER_SIZE)
+    {
+        counters_.reassemblyDrops.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-        // Re-publish locally (NOT through proxy to avoid re-broadcasting)
-        if (localBus_)
+    const uint32_t messageId = ReadU32LE(fragment);
+    const uint16_t index = ReadU16LE(fragment + 4);
+    const uint16_t count = ReadU16LE(fragment + 6);
+    const uint32_t totalSize = ReadU32LE(fragment + 8);
+    const uint8_t* bytes = fragment + FRAGMENT_HEADER_SIZE;
+    const size_t length = size - FRAGMENT_HEADER_SIZE;
+
+    // Every fragment but the last is full-sized, so the layout follows from totalSize
+    const size_t offset = static_cast<size_t>(index) * FRAGMENT_PAYLOAD_SIZE;
+    const bool valid = totalSize <= MAX_MESSAGE_SIZE && count != 0
+        && count == (totalSize + FRAGMENT_PAYLOAD_SIZE - 1) / FRAGMENT_PAYLOAD_SIZE
+        && index < count && length == (std::min)(FRAGMENT_PAYLOAD_SIZE, totalSize - offset);
+    if (!valid)
+    {
+        counters_.reassemblyDrops.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const auto key = std::make_pair(senderNodeId, messageId);
+    auto it = reassemblies_.find(key);
+    if (it == reassemblies_.end())
+    {
+        if (!HasFactory(eventId))
+            return; // Unknown event type: do not buffer it
+
+        // Make room: evict the oldest partial events first
+        while (!reassemblies_.empty() && (reassemblies_.size() >= MAX_REASSEMBLIES || reassemblyBytes_ + totalSize > MAX_REASSEMBLY_BYTES))
+        {
+            auto oldest = reassemblies_.begin();
+            for (auto r = reassemblies_.begin(); r != reassemblies_.end(); ++r)
+            {
+                if (r->second.started < oldest->second.started)
+                    oldest = r;
+            }
+            reassemblyBytes_ -= oldest->second.totalSize;
+            reassemblies_.erase(oldest);
+            counters_.reassemblyDrops.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Reassembly entry;
+        entry.eventId = eventId;
+        entry.totalSize = totalSize;
+        entry.count = count;
+        entry.have.assign(count, false);
+        entry.data = std::make_shared<std::vector<uint8_t>>(totalSize);
+        entry.started = std::chrono::steady_clock::now();
+        reassemblyBytes_ += totalSize;
+        it = reassemblies_.emplace(key, std::move(entry)).first;
+    }
+
+    Reassembly& entry = it->second;
+    if (entry.eventId != eventId || entry.totalSize != totalSize || entry.count != count)
+    {
+        counters_.reassemblyDrops.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (entry.have[index])
+        return; // Duplicate
+
+    memcpy(entry.data->data() + offset, bytes, length);
+    entry.have[index] = true;
+    if (++entry.received < entry.count)
+        return;
+
+    // Complete: the reassembly buffer becomes the payload's backing buffer
+    std::shared_ptr<std::vector<uint8_t>> data = std::move(entry.data);
+    reassemblyBytes_ -= entry.totalSize;
+    reassemblies_.erase(it);
+    counters_.reassembled.fetch_add(1, std::memory_order_relaxed);
+    PublishRemote(eventId, data, data->data(), data->size(), true);
+}
+
+void NetworkEventBusImpl::ExpireReassemblies(std::chrono::steady_clock::time_point now)
+{
+    if (now - lastExpiry_ < std::chrono::milliseconds(REASSEMBLY_TIMEOUT_MS / 4))
+        return;
+    lastExpiry_ = now;
+
+    for (auto it = reassemblies_.begin(); it != reassemblies_.end();)
+    {
+        if (now - it->second.started >= std::chrono::milliseconds(REASSEMBLY_TIMEOUT_MS))
+        {
+            reassemblyBytes_ -= it->second.totalSize;
+            it = reassemblies_.erase(it);
+            counters_.reassemblyTimeouts.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
         {
-            localBus_->Publish(eventId, evt, AxPlug::DispatchMode::DirectCall);
+            ++it;
         }
     }
 }
@@ -2,9 +2,12 @@
 
 #include "core/INetworkEventBus.h"
 #include "AxPlug/AxEventBus.h"
+#include "AxPlug/AxBufferEvent.h"
 #include "AxPlug/WinsockInit.hpp"
+#include <map>
 #include <unordered_map>
 #include <mutex>
+#include <condition_variable>
 #include <thread>
 #include <atomic>
 #include <vector>
@@ -32,8 +35,28 @@ public:
     explicit EventBusProxy(NetworkEventBusImpl* owner) : owner_(owner) {}
     ~EventBusProxy() override = default;
 
-    void Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
-    AxPlug::EventConnectionPtr Subscribe(uint64_t eventId, AxPlug::EventCallback callback, void* specificSender = nullptr) override;
+    void Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    void PublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr Subscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    AxPlug::EventConnectionPtr SubscribeOn(uint64_t eventId, AxPlug::EventMailboxPtr mailbox, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    std::vector<AxPlug::EventConnectionPtr> SubscribeBulk(std::vector<AxPlug::SubscriptionRequest> requests) override;
+    uint64_t RegisterTopic(const char* name) override;
+    AxPlug::EventConnectionPtr SubscribePattern(const char* pattern, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    AxPlug::EventConnectionPtr ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, AxPlug::InlineFunction<void()> task) override;
+    void SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes) override;
+    uint64_t RequestAsync(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, std::chrono::milliseconds timeout, AxPlug::ReplyHandler onReply, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
+    bool Reply(const AxPlug::AxEvent& request, std::shared_ptr<AxPlug::AxEvent> reply) override;
+    bool OpenJournal(const char* path, size_t capacityBytes) override;
+    void CloseJournal() override;
+    bool JournalEvent(uint64_t eventId, AxPlug::JournalEventFactory factory) override;
+    size_t ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
+    AxPlug::EventConnectionPtr PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    bool SetParallelDispatch(uint64_t eventId, bool enabled) override;
+    bool SetSticky(uint64_t eventId, bool enabled) override;
+    bool GetEventStats(uint64_t eventId, AxPlug::EventStats& stats) override;
+    std::vector<AxPlug::EventStats> GetAllEventStats() override;
+    bool GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts) override;
     void SetExceptionHandler(AxPlug::ExceptionHandler handler) override;
 
 private:
@@ -58,20 +81,77 @@ public:
     void RegisterNetworkableEvent(uint64_t eventId, AxPlug::NetworkEventFactory factory) override;
     AxPlug::IEventBus* AsEventBus() override;
     uint64_t GetNodeId() const override;
+    AxPlug::NetworkTransportStats GetTransportStats() const override;
+    void SetBatching(size_t datagramBytes, std::chrono::microseconds maxDelay) override;
+    void SetReliableDelivery(size_t retransmitBytes) override;
+    bool SetRateLimit(uint64_t eventId, double eventsPerSecond, uint32_t burst) override;
+    void SetInterestFiltering(bool enabled) override;
 
 protected:
     void Destroy() override { delete this; }
 
 private:
     // Called by EventBusProxy
-    void ProxyPublish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode);
-    AxPlug::EventConnectionPtr ProxySubscribe(uint64_t eventId, AxPlug::EventCallback callback, void* specificSender);
+    void ProxyPublish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority);
+    void ProxyPublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority);
+    AxPlug::EventConnectionPtr ProxySubscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender);
 
     // Network send: serialize INetworkableEvent and broadcast via UDP multicast
     void BroadcastToNetwork(uint64_t eventId, const std::shared_ptr<AxPlug::INetworkableEvent>& evt);
 
-    // Network receiver thread
+    // Header and payload go out as one datagram via gather I/O (no packet assembly
+    // copy); payloads that do not fit are split into fragments
+    void SendDatagram(uint64_t eventId, const void* payload, size_t size);
+    void SendParts(const uint8_t* header, size_t headerSize, const void* payload, size_t size);
+
+    // Several datagrams in one call (sendmmsg on Linux, one send each elsewhere)
+    struct OutgoingPart
+    {
+        const uint8_t* header;
+        size_t headerSize;
+        const void* payload;
+        size_t size;
+    };
+    void SendPartsBatch(const OutgoingPart* parts, size_t count);
+    void WriteParts(const OutgoingPart* parts, size_t count);
+
+    // Coalescing: append a small event to the pending datagram (false if it
+    // does not fit the budget on its own), flush when full or due
+    bool AppendToBatch(uint64_t eventId, const void* payload, size_t size);
+    void FlushBatchLocked();
+
+    // Sends due batches, reliable-delivery heartbeats and interest adverts
+    void SenderThread();
+
+    // Reliable delivery, sender side (under reliableMutex_): number and retain a
+    // datagram, bound the retained bytes, answer NAKs, advertise the sequence
+    OutgoingPart RetainLocked(const OutgoingPart& part);
+    void TrimRetainedLocked();
+    void OnNak(uint64_t firstSeq, uint32_t count);
+    void SendHeartbeat(bool force);
+    void SendHeartbeatLocked();
+
+    // Network receiver thread; HandleDatagram parses one received packet
     void ReceiverThread();
+    void HandleDatagram(const std::shared_ptr<std::vector<uint8_t>>& buffer, const uint8_t* data, size_t size);
+
+    // Reliable delivery, receiver side (receiver thread only)
+    struct PeerStream;
+    void OnSequenced(uint64_t seq, uint64_t senderNodeId, const uint8_t* inner, size_t size, const std::shared_ptr<std::vector<uint8_t>>& buffer);
+    void OnControl(uint64_t type, uint64_t senderNodeId, const uint8_t* payload, size_t size);
+    void DeliverHeld(PeerStream& peer);
+    void SkipTo(PeerStream& peer, uint64_t seq);
+    void SendNak(uint64_t senderNodeId, PeerStream& peer, std::chrono::steady_clock::time_point now);
+    void CheckStreams(std::chrono::steady_clock::time_point now);
+
+    // Deserialize a received payload and publish it on the local bus. AxBufferEvent
+    // payloads reference `holder` instead of copying when `zeroCopy` is set.
+    void PublishRemote(uint64_t eventId, const std::shared_ptr<std::vector<uint8_t>>& holder, const uint8_t* payload, size_t size, bool zeroCopy);
+    bool HasFactory(uint64_t eventId);
+
+    // Receiver thread only: add one fragment, publish the event once complete
+    void OnFragment(uint64_t eventId, uint64_t senderNodeId, const uint8_t* fragment, size_t size);
+    void ExpireReassemblies(std::chrono::steady_clock::time_point now);
 
     // Generate a 64-bit node ID for this process
     static uint64_t GenerateNodeId();
@@ -104,20 +184,198 @@ private:
     std::thread receiverThread_;
     std::atomic<bool> networkRunning_{ false };
 
-    // Anti-storm rate limiting: max broadcasts per event ID per window
-    struct RateLimit
+    // Per-eventId send state in a fixed open-addressed table; a slot is claimed
+    // once and never freed.
+    //  - Anti-storm rate limiting: one token bucket per event ID, kept as a GCRA
+    //    "theoretical arrival time" so a check is a single CAS.
+    //  - Count of broadcasts skipped because no peer wants the event ID.
+    static constexpr double DEFAULT_RATE_PER_SEC = 100.0; // sustained broadcasts per second per eventId
+    static constexpr uint32_t DEFAULT_BURST = 100;        // broadcasts allowed back to back
+    static constexpr size_t EVENT_SLOTS = 1024;           // distinct eventIds tracked (power of two)
+    static constexpr int64_t DEFAULT_INTERVAL_NS = static_cast<int64_t>(1e9 / DEFAULT_RATE_PER_SEC);
+
+    struct EventSlot
+    {
+        std::atomic<uint64_t> eventId{ 0 };                  // 0 = free slot
+        std::atomic<int64_t> intervalNs{ DEFAULT_INTERVAL_NS }; // ns per token; 0 = unlimited
+        std::atomic<int64_t> toleranceNs{ (DEFAULT_BURST - 1) * DEFAULT_INTERVAL_NS };
+        std::atomic<int64_t> tat{ 0 };                       // next conforming time (steady ns)
+        std::atomic<uint64_t> throttled{ 0 };
+        std::atomic<uint64_t> uninterested{ 0 };
+    };
+    EventSlot eventSlots_[EVENT_SLOTS];
+
+    // Interest check then rate limit: false skips serialization and send
+    bool AdmitBroadcast(uint64_t eventId);
+    bool CheckRateLimit(EventSlot& bucket, int64_t now);
+    EventSlot* FindEventSlot(uint64_t eventId);
+
+    // Peers' interest is kept apart from eventSlots_ so remote lists cannot use
+    // up the slots rate limits need: until when some peer last advertised each
+    // event ID (written by the receiver thread only, read by publishers). If it
+    // fills up, unknown event IDs count as wanted until the overflow lapses.
+    static constexpr size_t INTEREST_SLOTS = 1024; // power of two
+    struct InterestSlot
+    {
+        std::atomic<uint64_t> eventId{ 0 }; // 0 = never used; expired slots are reassigned
+        std::atomic<int64_t> untilNs{ 0 };  // steady ns
+    };
+    InterestSlot interestSlots_[INTEREST_SLOTS];
+    std::atomic<int64_t> interestOverflowUntilNs_{ 0 };
+    bool PeerInterested(uint64_t eventId, int64_t now) const;
+    void RecordInterest(uint64_t eventId, int64_t now, int64_t until);
+
+    // Interest advertisement: this node's subscribed + registered eventIds go out
+    // every INTEREST_INTERVAL_MS, and at once when they change or a peer asks
+    // (sender thread). Publishers skip eventIds no peer advertised while
+    // filtering is on, except during the grace period after StartNetwork.
+    void MarkInterestChanged();
+    void SendInterest(bool query);
+    void OnInterest(const uint8_t* payload, size_t size);
+    std::atomic<bool> interestFiltering_{ false };
+    std::atomic<bool> interestChanged_{ false };
+    std::atomic<int64_t> interestGraceUntilNs_{ 0 };
+
+    // Fragmentation: sender side message ids, receiver side partial events keyed
+    // by (sender node, message id). The table is touched only by the receiver thread.
+    struct Reassembly
+    {
+        uint64_t eventId = 0;
+        uint32_t totalSize = 0;
+        uint16_t count = 0;
+        uint16_t received = 0;
+        std::vector<bool> have;
+        std::shared_ptr<std::vector<uint8_t>> data;
+        std::chrono::steady_clock::time_point started;
+    };
+    std::map<std::pair<uint64_t, uint32_t>, Reassembly> reassemblies_;
+    size_t reassemblyBytes_ = 0;
+    std::chrono::steady_clock::time_point lastExpiry_;
+    std::atomic<uint32_t> nextMessageId_{ 0 };
+
+    // Pending batch datagram: [header][record]..., record = [8B eventId][4B size][payload].
+    // The sender thread sends it once batchDeadline_ passes.
+    std::mutex batchMutex_;
+    std::condition_variable batchCV_;
+    std::vector<uint8_t> batchBuffer_;
+    size_t batchRecords_ = 0;
+    std::chrono::steady_clock::time_point batchDeadline_;
+    std::chrono::microseconds batchDelay_{ 0 };
+    std::atomic<size_t> batchBudget_{ 0 }; // 0 = off
+    std::thread senderThread_;
+
+    // Reliable delivery, sender side: sequenced copies of the last datagrams, slot
+    // = seq % RETRANSMIT_SLOTS. Lock order: batchMutex_ before reliableMutex_.
+    struct RetransmitSlot
     {
-        std::chrono::steady_clock::time_point windowStart;
-        uint32_t count = 0;
+        uint64_t seq = 0; // 0 = empty
+        std::vector<uint8_t> bytes;
+        std::chrono::steady_clock::time_point retransmittedAt;
     };
-    std::unordered_map<uint64_t, RateLimit> rateLimitMap_;
-    std::mutex rateLimitMutex_;
-    static constexpr uint32_t RATE_LIMIT_MAX = 100;       // max packets per window per eventId
-    static constexpr int64_t  RATE_LIMIT_WINDOW_MS = 1000; // 1 second window
+    std::mutex reliableMutex_;
+    std::atomic<bool> reliable_{ false };
+    std::vector<RetransmitSlot> retransmitRing_;
+    size_t retransmitLimit_ = 0;
+    size_t retainedBytes_ = 0;
+    uint64_t nextSeq_ = 1;
+    uint64_t oldestSeq_ = 1;    // oldest sequence still retained
+    uint64_t heartbeatSeq_ = 0; // last sequence advertised by a heartbeat
+    uint32_t heartbeatRepeats_ = 0;
 
-    bool CheckRateLimit(uint64_t eventId);
+    // Reliable delivery, receiver side: one stream per sending node, receiver thread only
+    struct PeerStream
+    {
+        uint64_t expected = 0; // next sequence to deliver; 0 until the first datagram
+        uint64_t highest = 0;  // highest sequence received or advertised
+        std::map<uint64_t, std::shared_ptr<std::vector<uint8_t>>> held; // arrived past a gap
+        size_t heldBytes = 0;
+        std::chrono::steady_clock::time_point gapSince; // epoch = no gap
+        std::chrono::steady_clock::time_point lastNak;
+        std::chrono::steady_clock::time_point lastHeard;
+    };
+    std::unordered_map<uint64_t, PeerStream> peers_;
+    std::chrono::steady_clock::time_point lastStreamCheck_;
+
+    struct TransportCounters
+    {
+        std::atomic<uint64_t> fragmentedSent{ 0 };
+        std::atomic<uint64_t> fragmentsSent{ 0 };
+        std::atomic<uint64_t> fragmentsReceived{ 0 };
+        std::atomic<uint64_t> reassembled{ 0 };
+        std::atomic<uint64_t> reassemblyTimeouts{ 0 };
+        std::atomic<uint64_t> reassemblyDrops{ 0 };
+        std::atomic<uint64_t> oversizeDrops{ 0 };
+        std::atomic<uint64_t> batchesSent{ 0 };
+        std::atomic<uint64_t> batchedEvents{ 0 };
+        std::atomic<uint64_t> naksSent{ 0 };
+        std::atomic<uint64_t> retransmits{ 0 };
+        std::atomic<uint64_t> datagramsRecovered{ 0 };
+        std::atomic<uint64_t> datagramsLost{ 0 };
+        std::atomic<uint64_t> duplicatesDropped{ 0 };
+        std::atomic<uint64_t> interestAdverts{ 0 };
+    };
+    TransportCounters counters_;
 
     // Wire protocol header size
     static constexpr size_t HEADER_SIZE = 8 + 8 + 4; // eventId + nodeId + payloadLen
     static constexpr size_t MAX_PACKET_SIZE = 65000;  // UDP practical limit
+
+    // Received AxBufferEvent payloads at least this large keep the receive
+    // buffer (zero copy); smaller ones are copied out so the buffer is reused
+    static constexpr size_t ZERO_COPY_MIN_BYTES = 4096;
+
+    // Per-thread SerializeTo buffer is released after an event larger than this
+    static constexpr size_t SCRATCH_KEEP_BYTES = 1024 * 1024;
+
+    // Fragment datagrams set FRAGMENT_FLAG in the header's payloadLen and carry a
+    // fragment header before the fragment bytes. Older receivers see an
+    // impossible length and discard them as truncated.
+    static constexpr uint32_t FRAGMENT_FLAG = 0x80000000u;
+    static constexpr size_t FRAGMENT_HEADER_SIZE = 4 + 2 + 2 + 4; // messageId + index + count + totalSize
+    static constexpr size_t FRAGMENT_PAYLOAD_SIZE = MAX_PACKET_SIZE - HEADER_SIZE - FRAGMENT_HEADER_SIZE;
+    static constexpr size_t MAX_MESSAGE_SIZE = 16 * 1024 * 1024;   // largest event sent as fragments
+    static constexpr size_t MAX_REASSEMBLIES = 32;                 // partial events held at once
+    static constexpr size_t MAX_REASSEMBLY_BYTES = 64 * 1024 * 1024;
+    static constexpr int64_t REASSEMBLY_TIMEOUT_MS = 2000;
+    static constexpr int RECV_BUFFER_BYTES = 8 * 1024 * 1024;      // SO_RCVBUF: absorb fragment bursts
+
+    // Linux: datagrams per recvmmsg / sendmmsg call. The receiver keeps a ring of
+    // this many preallocated packet buffers.
+    static constexpr size_t RECV_BATCH = 16;
+    static constexpr size_t SEND_BATCH = 16;
+
+    // Batched datagrams set BATCH_FLAG in payloadLen; eventId in the header is unused
+    static constexpr uint32_t BATCH_FLAG = 0x40000000u;
+    static constexpr size_t BATCH_RECORD_HEADER_SIZE = 8 + 4; // eventId + size
+
+    // Reliable delivery. A sequenced datagram is [seq][nodeId][RELIABLE_FLAG | len]
+    // followed by the whole original datagram. Control datagrams carry the type
+    // in the eventId field: NAK [8B target nodeId][8B first seq][4B count],
+    // heartbeat [8B last seq sent][8B oldest seq retained], interest [4B count]
+    // [count x 8B eventId] (interest query: same, and peers answer with theirs).
+    static constexpr uint32_t RELIABLE_FLAG = 0x20000000u;
+    static constexpr uint32_t CONTROL_FLAG = 0x10000000u;
+    static constexpr uint32_t FLAG_MASK = FRAGMENT_FLAG | BATCH_FLAG | RELIABLE_FLAG | CONTROL_FLAG;
+    static constexpr uint64_t CONTROL_NAK = 1;
+    static constexpr uint64_t CONTROL_HEARTBEAT = 2;
+    static constexpr uint64_t CONTROL_INTEREST = 3;
+    static constexpr uint64_t CONTROL_INTEREST_QUERY = 4;
+    static constexpr size_t NAK_SIZE = 8 + 8 + 4;
+    static constexpr size_t HEARTBEAT_SIZE = 8 + 8;
+    static constexpr size_t RECV_PACKET_SIZE = MAX_PACKET_SIZE + HEADER_SIZE; // room for the sequence wrapper
+
+    static constexpr size_t RETRANSMIT_SLOTS = 4096;           // datagrams retained at most
+    static constexpr int64_t HEARTBEAT_INTERVAL_MS = 100;      // while the sequence is advancing
+    static constexpr uint32_t HEARTBEAT_REPEATS = 3;           // heartbeats after the last send
+    static constexpr int64_t NAK_INTERVAL_MS = 20;             // re-NAK an open gap / suppress repeat retransmits
+    static constexpr int64_t GAP_TIMEOUT_MS = 1000;            // give up on a gap, count it lost
+    static constexpr size_t MAX_HELD_DATAGRAMS = 1024;         // per sender, waiting behind a gap
+    static constexpr size_t MAX_HELD_BYTES = 16 * 1024 * 1024;
+    static constexpr int64_t PEER_TIMEOUT_MS = 30000;          // forget silent senders
+
+    // Remote interest
+    static constexpr int64_t INTEREST_INTERVAL_MS = 1000;      // re-advertise this node's eventIds
+    static constexpr int64_t INTEREST_TIMEOUT_MS = 3500;       // a peer's interest lapses after ~3 missed adverts
+    static constexpr int64_t INTEREST_GRACE_MS = 1000;         // send everything while peers answer the first query
+    static constexpr size_t INTEREST_IDS_PER_DATAGRAM = (MAX_PACKET_SIZE - HEADER_SIZE - 4) / 8;
 };
@@ -0,0 +1,392 @@
+#include "ShmEventBusImpl.h"
+#include <cstdio>
+#include <chrono>
+#include <random>
+
+// ============================================================
+// ShmEventBusProxy - delegates to ShmEventBusImpl
+// ============================================================
+void ShmEventBusProxy::Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    owner_->ProxyPublish(eventId, std::move(payload), mode, priority);
+}
+
+void ShmEventBusProxy::PublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    owner_->ProxyPublishBatch(eventId, payloads, count, mode, priority);
+}
+
+// All subscriptions live on the local bus; remote events are re-published there
+AxPlug::EventConnectionPtr ShmEventBusProxy::Subscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender)
+{
+    if (owner_->localBus_) return owner_->localBus_->Subscribe(eventId, std::move(handler), specificSender);
+    return nullptr;
+}
+
+AxPlug::EventConnectionPtr ShmEventBusProxy::SubscribeOn(uint64_t eventId, AxPlug::EventMailboxPtr mailbox, AxPlug::EventHandler handler, void* specificSender)
+{
+    if (owner_->localBus_) return owner_->localBus_->SubscribeOn(eventId, std::move(mailbox), std::move(handler), specificSender);
+    return nullptr;
+}
+
+std::vector<AxPlug::EventConnectionPtr> ShmEventBusProxy::SubscribeBulk(std::vector<AxPlug::SubscriptionRequest> requests)
+{
+    if (owner_->localBus_) return owner_->localBus_->SubscribeBulk(std::move(requests));
+    return {};
+}
+
+uint64_t ShmEventBusProxy::RegisterTopic(const char* name)
+{
+    if (owner_->localBus_) return owner_->localBus_->RegisterTopic(name);
+    return AxPlug::HashEventId(name);
+}
+
+AxPlug::EventConnectionPtr ShmEventBusProxy::SubscribePattern(const char* pattern, AxPlug::EventHandler handler, void* specificSender)
+{
+    if (owner_->localBus_) return owner_->localBus_->SubscribePattern(pattern, std::move(handler), specificSender);
+    return nullptr;
+}
+
+// Tasks run on the local bus's event loop
+AxPlug::EventConnectionPtr ShmEventBusProxy::ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, AxPlug::InlineFunction<void()> task)
+{
+    if (owner_->localBus_) return owner_->localBus_->ScheduleTask(delay, period, std::move(task));
+    return nullptr;
+}
+
+void ShmEventBusProxy::SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes)
+{
+    if (owner_->localBus_) owner_->localBus_->SetSlowSubscriberPolicy(budget, strikes);
+}
+
+// Requests and replies are matched by the local bus; the request itself is
+// published locally only (a correlationId means nothing to another process)
+uint64_t ShmEventBusProxy::RequestAsync(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, std::chrono::milliseconds timeout, AxPlug::ReplyHandler onReply, AxPlug::DispatchMode mode)
+{
+    if (owner_->localBus_) return owner_->localBus_->RequestAsync(eventId, std::move(payload), timeout, std::move(onReply), mode);
+    if (onReply) onReply(nullptr);
+    return 0;
+}
+
+bool ShmEventBusProxy::Reply(const AxPlug::AxEvent& request, std::shared_ptr<AxPlug::AxEvent> reply)
+{
+    return owner_->localBus_ && owner_->localBus_->Reply(request, std::move(reply));
+}
+
+// Journal, timers and metrics are local-bus features; replayed and timed
+// events are delivered in this process only
+bool ShmEventBusProxy::OpenJournal(const char* path, size_t capacityBytes)
+{
+    return owner_->localBus_ && owner_->localBus_->OpenJournal(path, capacityBytes);
+}
+
+void ShmEventBusProxy::CloseJournal()
+{
+    if (owner_->localBus_) owner_->localBus_->CloseJournal();
+}
+
+bool ShmEventBusProxy::JournalEvent(uint64_t eventId, AxPlug::JournalEventFactory factory)
+{
+    return owner_->localBus_ && owner_->localBus_->JournalEvent(eventId, std::move(factory));
+}
+
+size_t ShmEventBusProxy::ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, AxPlug::DispatchMode mode)
+{
+    return owner_->localBus_ ? owner_->localBus_->ReplayJournal(from, to, mode) : 0;
+}
+
+AxPlug::EventConnectionPtr ShmEventBusProxy::PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority)
+{
+    if (owner_->localBus_) return owner_->localBus_->PublishAfter(delay, eventId, std::move(payload), priority);
+    return nullptr;
+}
+
+AxPlug::EventConnectionPtr ShmEventBusProxy::PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority)
+{
+    if (owner_->localBus_) return owner_->localBus_->PublishEvery(period, eventId, std::move(payload), priority);
+    return nullptr;
+}
+
+// Parallel fan-out only applies to local subscribers
+bool ShmEventBusProxy::SetParallelDispatch(uint64_t eventId, bool enabled)
+{
+    return owner_->localBus_ && owner_->localBus_->SetParallelDispatch(eventId, enabled);
+}
+
+// Remote events are re-published on the local bus, so they become sticky there too
+bool ShmEventBusProxy::SetSticky(uint64_t eventId, bool enabled)
+{
+    return owner_->localBus_ && owner_->localBus_->SetSticky(eventId, enabled);
+}
+
+bool ShmEventBusProxy::GetEventStats(uint64_t eventId, AxPlug::EventStats& stats)
+{
+    if (owner_->localBus_) return owner_->localBus_->GetEventStats(eventId, stats);
+    return false;
+}
+
+std::vector<AxPlug::EventStats> ShmEventBusProxy::GetAllEventStats()
+{
+    if (owner_->localBus_) return owner_->localBus_->GetAllEventStats();
+    return {};
+}
+
+bool ShmEventBusProxy::GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts)
+{
+    return owner_->localBus_ && owner_->localBus_->GetSubscriberCounts(eventIds, count, counts);
+}
+
+void ShmEventBusProxy::SetExceptionHandler(AxPlug::ExceptionHandler handler)
+{
+    if (owner_->localBus_) owner_->localBus_->SetExceptionHandler(std::move(handler));
+}
+
+// ============================================================
+// ShmEventBusImpl
+// ============================================================
+ShmEventBusImpl::ShmEventBusImpl()
+{
+    nodeId_ = GenerateNodeId();
+    proxy_ = std::make_unique<ShmEventBusProxy>(this);
+}
+
+ShmEventBusImpl::~ShmEventBusImpl()
+{
+    StopShm();
+}
+
+void ShmEventBusImpl::OnInit()
+{
+    // Save the current local bus and perform takeover ("夺舍")
+    localBus_ = Ax_GetEventBus();
+    Ax_SetEventBus(proxy_.get());
+}
+
+void ShmEventBusImpl::OnShutdown()
+{
+    StopShm();
+    // Restore original local bus (critical: nullptr would kill all event routing)
+    if (localBus_)
+    {
+        Ax_SetEventBus(localBus_);
+        localBus_ = nullptr;
+    }
+}
+
+// ============================================================
+// IShmEventBus interface
+// ============================================================
+bool ShmEventBusImpl::StartShm(const char* segmentName, size_t ringBytes)
+{
+    if (shmRunning_.load(std::memory_order_acquire))
+        return true;
+
+    if (!segmentName || !*segmentName)
+        return false;
+
+    if (!segment_.Open(segmentName, ringBytes))
+        return false;
+
+    if (!segment_.Attach(nodeId_))
+    {
+        segment_.Close();
+        return false;
+    }
+
+    shmRunning_.store(true, std::memory_order_release);
+    receiverThread_ = std::thread(&ShmEventBusImpl::ReceiverThread, this);
+
+    fprintf(stderr, "[ShmEventBus] Attached to '%s' (nodeId=0x%llx)\n", segmentName, static_cast<unsigned long long>(nodeId_));
+    return true;
+}
+
+void ShmEventBusImpl::StopShm()
+{
+    bool expected = true;
+    if (!shmRunning_.compare_exchange_strong(expected, false, std::memory_order_seq_cst))
+        return;
+
+    if (receiverThread_.joinable())
+        receiverThread_.join();
+
+    // Publishers that saw the segment running may still be writing into it
+    while (broadcasting_.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+    segment_.Close();
+}
+
+bool ShmEventBusImpl::EnterBroadcast()
+{
+    broadcasting_.fetch_add(1, std::memory_order_seq_cst);
+    if (!shmRunning_.load(std::memory_order_seq_cst))
+    {
+        LeaveBroadcast();
+        return false;
+    }
+    return true;
+}
+
+bool ShmEventBusImpl::IsShmActive() const
+{
+    return shmRunning_.load(std::memory_order_acquire);
+}
+
+void ShmEventBusImpl::RegisterNetworkableEvent(uint64_t eventId, AxPlug::NetworkEventFactory factory)
+{
+    std::lock_guard<std::mutex> lock(factoryMutex_);
+    factoryRegistry_[eventId] = std::move(factory);
+}
+
+AxPlug::IEventBus* ShmEventBusImpl::AsEventBus()
+{
+    return proxy_.get();
+}
+
+uint64_t ShmEventBusImpl::GetNodeId() const
+{
+    return nodeId_;
+}
+
+uint64_t ShmEventBusImpl::GetDroppedCount() const
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+// ============================================================
+// Proxy Publish: local dispatch + copy into peer inboxes
+// ============================================================
+void ShmEventBusImpl::ProxyPublish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    // Step 1: Always dispatch locally first via the original bus
+    if (localBus_)
+    {
+        localBus_->Publish(eventId, payload, mode, priority);
+    }
+
+    // Step 2: Only INetworkableEvent subtypes cross the process boundary
+    if (shmRunning_.load(std::memory_order_acquire))
+    {
+        auto netEvent = std::dynamic_pointer_cast<AxPlug::INetworkableEvent>(payload);
+        if (netEvent && EnterBroadcast())
+        {
+            BroadcastToPeers(eventId, netEvent);
+            LeaveBroadcast();
+        }
+    }
+}
+
+void ShmEventBusImpl::ProxyPublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority)
+{
+    // Local batch keeps the single-snapshot / single-wakeup fast path
+    if (localBus_)
+    {
+        localBus_->PublishBatch(eventId, payloads, count, mode, priority);
+    }
+
+    if (shmRunning_.load(std::memory_order_acquire) && EnterBroadcast())
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto netEvent = std::dynamic_pointer_cast<AxPlug::INetworkableEvent>(payloads[i]);
+            if (netEvent)
+            {
+                BroadcastToPeers(eventId, netEvent);
+            }
+        }
+        LeaveBroadcast();
+    }
+}
+
+// ============================================================
+// BroadcastToPeers - serialize once, one ring write per peer
+// ============================================================
+void ShmEventBusImpl::BroadcastToPeers(uint64_t eventId, const std::shared_ptr<AxPlug::INetworkableEvent>& evt)
+{
+    // Byte-slice payloads are copied into the rings straight from their buffer,
+    // span-serializable ones from a reused per-thread buffer
+    thread_local std::vector<uint8_t> scratch;
+    std::string serialized;
+    const char* data;
+    size_t size = 0;
+    if (auto* buffer = dynamic_cast<const AxPlug::AxBufferEvent*>(evt.get()))
+    {
+        data = reinterpret_cast<const char*>(buffer->bytes.data());
+        size = buffer->bytes.size();
+    }
+    else if (evt->SerializeInto(scratch, size))
+    {
+        data = reinterpret_cast<const char*>(scratch.data());
+    }
+    else
+    {
+        serialized = evt->Serialize();
+        data = serialized.data();
+        size = serialized.size();
+    }
+
+    if (size > segment_.MaxPayload())
+    {
+        fprintf(stderr, "[ShmEventBus] Event 0x%llx payload too large (%zu bytes), skipping\n", static_cast<unsigned long long>(eventId), size);
+    }
+    else if (uint32_t full = segment_.Broadcast(eventId, nodeId_, data, size))
+    {
+        dropped_.fetch_add(full, std::memory_order_relaxed);
+    }
+
+    // Keep the per-thread buffer no larger than one ring can carry
+    if (scratch.capacity() > segment_.MaxPayload())
+        std::vector<uint8_t>().swap(scratch);
+}
+
+// ============================================================
+// ReceiverThread - drains our inbox and re-publishes locally
+// ============================================================
+void ShmEventBusImpl::ReceiverThread()
+{
+    auto deliver = [this](uint64_t eventId, uint64_t, const char* data, size_t size) {
+        // Look up factory for this eventId
+        AxPlug::NetworkEventFactory factory;
+        {
+            std::lock_guard<std::mutex> lock(factoryMutex_);
+            auto it = factoryRegistry_.find(eventId);
+            if (it == factoryRegistry_.end())
+                return; // Unknown event type, skip
+            factory = it->second;
+        }
+
+        auto evt = factory();
+        if (!evt)
+            return;
+        if (auto* buffer = dynamic_cast<AxPlug::AxBufferEvent*>(evt.get()))
+            buffer->bytes = AxPlug::ByteSlice::Copy(data, size); // one copy out of the ring, no intermediate string
+        else
+            evt->DeserializeFrom(reinterpret_cast<const uint8_t*>(data), size);
+
+        // Re-publish locally (NOT through proxy to avoid re-broadcasting)
+        if (localBus_)
+        {
+            localBus_->Publish(eventId, evt, AxPlug::DispatchMode::DirectCall);
+        }
+    };
+
+    while (shmRunning_.load(std::memory_order_acquire))
+    {
+        if (segment_.Drain(deliver) == 0)
+        {
+            segment_.Wait(std::chrono::milliseconds(RECEIVER_WAIT_MS));
+        }
+    }
+}
+
+// ============================================================
+// GenerateNodeId - unique 64-bit ID for this process instance
+// ============================================================
+uint64_t ShmEventBusImpl::GenerateNodeId()
+{
+    auto now = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    std::random_device rd;
+    uint64_t r = rd();
+    // Mix time + random for uniqueness; 0 marks a free slot on the segment
+    uint64_t id = static_cast<uint64_t>(now) ^ (r << 32) ^ (r >> 32);
+    return id ? id : 1;
+}
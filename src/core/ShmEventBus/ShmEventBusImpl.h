@@ -0,0 +1,130 @@
+#pragma once
+
+#include "core/IShmEventBus.h"
+#include "AxPlug/AxEventBus.h"
+#include "AxPlug/AxBufferEvent.h"
+#include "ShmSegment.h"
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// ShmEventBusImpl - Proxy pattern implementation that wraps the local DefaultEventBus
+// and adds a same-host shared-memory transport for INetworkableEvent subtypes.
+//
+// Architecture:
+//   - Implements IShmEventBus (IAxObject) for plugin lifecycle
+//   - Contains an inner ShmEventBusProxy (IEventBus) for transparent bus replacement
+//   - On Publish: local dispatch via wrapped bus + copy into every peer's inbox ring
+//   - Receiver thread: drains our inbox, deserializes, re-publishes locally
+//
+// Unlike the UDP transport there is no packet framing or loopback filtering:
+// the ring record carries {eventId, senderNode, size} and a process never
+// writes into its own inbox.
+
+class ShmEventBusImpl;
+
+// Inner IEventBus proxy that delegates to ShmEventBusImpl
+class ShmEventBusProxy : public AxPlug::IEventBus
+{
+public:
+    explicit ShmEventBusProxy(ShmEventBusImpl* owner) : owner_(owner) {}
+    ~ShmEventBusProxy() override = default;
+
+    void Publish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    void PublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr Subscribe(uint64_t eventId, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    AxPlug::EventConnectionPtr SubscribeOn(uint64_t eventId, AxPlug::EventMailboxPtr mailbox, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    std::vector<AxPlug::EventConnectionPtr> SubscribeBulk(std::vector<AxPlug::SubscriptionRequest> requests) override;
+    uint64_t RegisterTopic(const char* name) override;
+    AxPlug::EventConnectionPtr SubscribePattern(const char* pattern, AxPlug::EventHandler handler, void* specificSender = nullptr) override;
+    AxPlug::EventConnectionPtr ScheduleTask(std::chrono::milliseconds delay, std::chrono::milliseconds period, AxPlug::InlineFunction<void()> task) override;
+    void SetSlowSubscriberPolicy(std::chrono::microseconds budget, uint32_t strikes) override;
+    uint64_t RequestAsync(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, std::chrono::milliseconds timeout, AxPlug::ReplyHandler onReply, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
+    bool Reply(const AxPlug::AxEvent& request, std::shared_ptr<AxPlug::AxEvent> reply) override;
+    bool OpenJournal(const char* path, size_t capacityBytes) override;
+    void CloseJournal() override;
+    bool JournalEvent(uint64_t eventId, AxPlug::JournalEventFactory factory) override;
+    size_t ReplayJournal(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, AxPlug::DispatchMode mode = AxPlug::DispatchMode::DirectCall) override;
+    AxPlug::EventConnectionPtr PublishAfter(std::chrono::milliseconds delay, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    AxPlug::EventConnectionPtr PublishEvery(std::chrono::milliseconds period, uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::EventPriority priority = AxPlug::EventPriority::Normal) override;
+    bool SetParallelDispatch(uint64_t eventId, bool enabled) override;
+    bool SetSticky(uint64_t eventId, bool enabled) override;
+    bool GetEventStats(uint64_t eventId, AxPlug::EventStats& stats) override;
+    std::vector<AxPlug::EventStats> GetAllEventStats() override;
+    bool GetSubscriberCounts(const uint64_t* eventIds, size_t count, size_t* counts) override;
+    void SetExceptionHandler(AxPlug::ExceptionHandler handler) override;
+
+private:
+    ShmEventBusImpl* owner_;
+};
+
+class ShmEventBusImpl : public AxPlug::IShmEventBus
+{
+    friend class ShmEventBusProxy;
+public:
+    ShmEventBusImpl();
+    ~ShmEventBusImpl() override;
+
+    // IAxObject lifecycle
+    void OnInit() override;
+    void OnShutdown() override;
+
+    // IShmEventBus interface
+    bool StartShm(const char* segmentName, size_t ringBytes) override;
+    void StopShm() override;
+    bool IsShmActive() const override;
+    void RegisterNetworkableEvent(uint64_t eventId, AxPlug::NetworkEventFactory factory) override;
+    AxPlug::IEventBus* AsEventBus() override;
+    uint64_t GetNodeId() const override;
+    uint64_t GetDroppedCount() const override;
+
+protected:
+    void Destroy() override { delete this; }
+
+private:
+    // Called by ShmEventBusProxy
+    void ProxyPublish(uint64_t eventId, std::shared_ptr<AxPlug::AxEvent> payload, AxPlug::DispatchMode mode, AxPlug::EventPriority priority);
+    void ProxyPublishBatch(uint64_t eventId, const std::shared_ptr<AxPlug::AxEvent>* payloads, size_t count, AxPlug::DispatchMode mode, AxPlug::EventPriority priority);
+
+    // Serialize INetworkableEvent once and copy it into every peer inbox
+    void BroadcastToPeers(uint64_t eventId, const std::shared_ptr<AxPlug::INetworkableEvent>& evt);
+
+    // Pins the segment mapping for one broadcast; false once StopShm has begun.
+    // StopShm waits for pinned broadcasts before it unmaps.
+    bool EnterBroadcast();
+    void LeaveBroadcast() { broadcasting_.fetch_sub(1, std::memory_order_release); }
+
+    // Inbox receiver thread
+    void ReceiverThread();
+
+    // Generate a 64-bit node ID for this process
+    static uint64_t GenerateNodeId();
+
+    // --- Data members ---
+
+    // The original local event bus (saved before takeover)
+    AxPlug::IEventBus* localBus_ = nullptr;
+
+    // The proxy IEventBus that replaces the default bus
+    std::unique_ptr<ShmEventBusProxy> proxy_;
+
+    // Networkable event factory registry: eventId -> factory
+    std::unordered_map<uint64_t, AxPlug::NetworkEventFactory> factoryRegistry_;
+    std::mutex factoryMutex_;
+
+    ShmSegment segment_;
+    uint64_t nodeId_ = 0;
+
+    std::thread receiverThread_;
+    std::atomic<bool> shmRunning_{ false };
+    std::atomic<uint32_t> broadcasting_{ 0 };
+    std::atomic<uint64_t> dropped_{ 0 };
+
+    // Receiver wakes at least this often to notice StopShm
+    static constexpr int RECEIVER_WAIT_MS = 100;
+};
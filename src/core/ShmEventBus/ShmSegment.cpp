@@ -0,0 +1,484 @@
+#include "ShmSegment.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shm rings need lock-free 64-bit atomics");
+
+namespace
+{
+constexpr char SEGMENT_MAGIC[8] = { 'A', 'X', 'S', 'H', 'M', 'B', '2', '\0' };
+constexpr size_t HEADER_BYTES = 4096;
+constexpr uint32_t STATE_READY = 2;
+
+uint64_t Align8(uint64_t v) { return (v + 7) & ~uint64_t(7); }
+} // namespace
+
+// Producer and consumer cursors live on separate cache lines
+struct ShmSegment::Slot
+{
+    alignas(64) std::atomic<uint32_t> pid;  // claim word: 0 = free
+    std::atomic<uint32_t> wakeSeq;          // futex word, bumped on wake
+    std::atomic<uint32_t> sleeping;         // consumer is blocked (or about to be) in Wait
+    std::atomic<uint64_t> nodeId;           // 0 = not accepting events
+    alignas(64) std::atomic<uint64_t> head; // producers: bytes reserved
+    alignas(64) std::atomic<uint64_t> tail; // consumer: bytes consumed
+};
+
+struct ShmSegment::Header
+{
+    char magic[8];
+    std::atomic<uint32_t> state; // 0 = zeroed, 1 = initializing, 2 = ready
+    uint32_t maxProcesses;
+    uint64_t ringBytes;
+    Slot slots[MAX_PROCESSES];
+};
+
+// Same record scheme as the event journal: 8-byte aligned, tag == offset | 1
+// marks a committed record, so stale data from an earlier lap never matches.
+// tag == offset | 2 marks a reservation whose {length, pid} word is valid.
+struct ShmSegment::RecordHeader
+{
+    uint64_t tag;
+    uint32_t length;      // header + payload, aligned to 8 (written at reservation)
+    uint32_t producerPid; // written together with length
+    uint64_t eventId;
+    uint64_t senderNode;
+    uint32_t size;        // payload bytes
+    uint32_t reserved;
+};
+
+namespace
+{
+constexpr uint64_t TAG_COMMITTED = 1;
+constexpr uint64_t TAG_RESERVED = 2;
+} // namespace
+
+ShmSegment::~ShmSegment()
+{
+    Close();
+}
+
+// ============================================================
+// Open / Close - map the named segment, first process initializes it
+// ============================================================
+bool ShmSegment::Open(const char* name, size_t ringBytes)
+{
+    static_assert(sizeof(Header) <= HEADER_BYTES, "slot table must fit in the header page");
+    Close();
+
+    uint64_t ring = (std::max)((static_cast<uint64_t>(ringBytes) + 4095) / 4096 * 4096, static_cast<uint64_t>(64 * 1024));
+    size_t total = static_cast<size_t>(HEADER_BYTES + ring * MAX_PROCESSES);
+    void* view = nullptr;
+
+#ifdef _WIN32
+    std::string mapName = std::string("Local\\") + name;
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(static_cast<uint64_t>(total) >> 32), static_cast<DWORD>(total & 0xFFFFFFFFu), mapName.c_str());
+    if (!mapping)
+    {
+        fprintf(stderr, "[ShmEventBus] Cannot create segment '%s' (error %lu)\n", name, GetLastError());
+        return false;
+    }
+    view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, total);
+    if (!view)
+    {
+        fprintf(stderr, "[ShmEventBus] Cannot map segment '%s' (error %lu)\n", name, GetLastError());
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_ = mapping;
+#else
+    std::string shmName = std::string("/") + name;
+    int fd = shm_open(shmName.c_str(), O_RDWR | O_CREAT, 0600);
+    if (fd < 0)
+    {
+        fprintf(stderr, "[ShmEventBus] Cannot open segment '%s'\n", name);
+        return false;
+    }
+    struct stat st{};
+    fstat(fd, &st);
+    if (st.st_size == 0 && ftruncate(fd, static_cast<off_t>(total)) != 0)
+    {
+        fprintf(stderr, "[ShmEventBus] Cannot size segment '%s'\n", name);
+        ::close(fd);
+        return false;
+    }
+    if (st.st_size != 0 && static_cast<size_t>(st.st_size) != total)
+    {
+        fprintf(stderr, "[ShmEventBus] Segment '%s' exists with a different ring size\n", name);
+        ::close(fd);
+        return false;
+    }
+    view = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+    {
+        fprintf(stderr, "[ShmEventBus] Cannot map segment '%s'\n", name);
+        return false;
+    }
+#endif
+
+    header_ = static_cast<Header*>(view);
+    mappedSize_ = total;
+    name_ = name;
+
+    // Zero-filled memory is a valid "state == 0" header; one process wins the init
+    uint32_t expected = 0;
+    if (header_->state.compare_exchange_strong(expected, 1, std::memory_order_acq_rel))
+    {
+        memcpy(header_->magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+        header_->maxProcesses = MAX_PROCESSES;
+        header_->ringBytes = ring;
+        header_->state.store(STATE_READY, std::memory_order_release);
+    }
+    else
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (header_->state.load(std::memory_order_acquire) != STATE_READY && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+    }
+
+    if (header_->state.load(std::memory_order_acquire) != STATE_READY || memcmp(header_->magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) != 0 ||
+        header_->maxProcesses != MAX_PROCESSES || header_->ringBytes != ring)
+    {
+        fprintf(stderr, "[ShmEventBus] Segment '%s' has an incompatible layout\n", name);
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void ShmSegment::Close()
+{
+    Detach();
+#ifdef _WIN32
+    if (header_)
+        UnmapViewOfFile(header_);
+    if (mapping_)
+        CloseHandle(static_cast<HANDLE>(mapping_));
+    mapping_ = nullptr;
+#else
+    if (header_)
+        munmap(header_, mappedSize_);
+#endif
+    header_ = nullptr;
+    mappedSize_ = 0;
+}
+
+// ============================================================
+// Attach / Detach - slot ownership
+// ============================================================
+bool ShmSegment::Attach(uint64_t nodeId)
+{
+    if (!header_ || nodeId == 0)
+        return false;
+    Detach();
+
+    uint32_t pid = CurrentPid();
+    for (uint32_t i = 0; i < MAX_PROCESSES; ++i)
+    {
+        Slot& slot = header_->slots[i];
+        uint32_t owner = slot.pid.load(std::memory_order_acquire);
+
+        // Reclaim slots left behind by crashed processes
+        if (owner != 0 && !IsProcessAlive(owner))
+        {
+            uint64_t staleNode = slot.nodeId.load(std::memory_order_acquire);
+            if (slot.pid.compare_exchange_strong(owner, 0, std::memory_order_acq_rel))
+            {
+                slot.nodeId.compare_exchange_strong(staleNode, 0, std::memory_order_acq_rel);
+                owner = 0;
+            }
+        }
+        if (owner != 0 || !slot.pid.compare_exchange_strong(owner, pid, std::memory_order_acq_rel))
+            continue;
+
+        // Skip anything a previous owner left unconsumed, then start accepting
+        slot.tail.store(slot.head.load(std::memory_order_acquire), std::memory_order_release);
+        slot.sleeping.store(0, std::memory_order_relaxed);
+        self_ = static_cast<int32_t>(i);
+#ifdef _WIN32
+        std::string eventName = "Local\\" + name_ + ".wake" + std::to_string(i);
+        wakeEvent_ = CreateEventA(nullptr, FALSE, FALSE, eventName.c_str());
+#endif
+        slot.nodeId.store(nodeId, std::memory_order_release);
+        return true;
+    }
+    fprintf(stderr, "[ShmEventBus] Segment '%s' is full (%u processes)\n", name_.c_str(), MAX_PROCESSES);
+    return false;
+}
+
+void ShmSegment::Detach()
+{
+    if (!header_ || self_ < 0)
+        return;
+    Slot& slot = header_->slots[self_];
+    slot.nodeId.store(0, std::memory_order_release);
+    slot.pid.store(0, std::memory_order_release);
+    self_ = -1;
+#ifdef _WIN32
+    if (wakeEvent_)
+        CloseHandle(static_cast<HANDLE>(wakeEvent_));
+    wakeEvent_ = nullptr;
+#endif
+}
+
+// ============================================================
+// Producer side
+// ============================================================
+uint64_t ShmSegment::RingBytes() const
+{
+    return header_->ringBytes;
+}
+
+char* ShmSegment::RingOf(uint32_t slot) const
+{
+    return reinterpret_cast<char*>(header_) + HEADER_BYTES + slot * header_->ringBytes;
+}
+
+size_t ShmSegment::MaxPayload() const
+{
+    return header_ ? static_cast<size_t>(RingBytes() / 4 - sizeof(RecordHeader)) : 0;
+}
+
+uint32_t ShmSegment::Broadcast(uint64_t eventId, uint64_t senderNode, const char* data, size_t size)
+{
+    if (!header_)
+        return 0;
+    uint32_t dropped = 0;
+    for (uint32_t i = 0; i < MAX_PROCESSES; ++i)
+    {
+        if (static_cast<int32_t>(i) == self_ || header_->slots[i].nodeId.load(std::memory_order_acquire) == 0)
+            continue;
+        if (!Write(i, eventId, senderNode, data, size))
+            ++dropped;
+    }
+    return dropped;
+}
+
+bool ShmSegment::Write(uint32_t index, uint64_t eventId, uint64_t senderNode, const char* data, size_t size)
+{
+    Slot& slot = header_->slots[index];
+    const uint64_t ring = RingBytes();
+    const uint64_t length = Align8(sizeof(RecordHeader) + size);
+    if (length > ring / 4)
+        return false;
+
+    // Reserve without ever passing the consumer: a full inbox drops, never blocks
+    uint64_t pos = slot.head.load(std::memory_order_relaxed);
+    do
+    {
+        if (pos + length - slot.tail.load(std::memory_order_acquire) > ring)
+            return false;
+    } while (!slot.head.compare_exchange_weak(pos, pos + length, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    char* base = RingOf(index);
+    auto wordAt = [&](uint64_t at) { return reinterpret_cast<std::atomic<uint64_t>*>(base + at % ring); };
+    auto copyIn = [&](uint64_t at, const void* src, size_t n) {
+        size_t offset = static_cast<size_t>(at % ring);
+        size_t first = (std::min)(n, static_cast<size_t>(ring) - offset);
+        memcpy(base + offset, src, first);
+        if (first < n)
+            memcpy(base, static_cast<const char*>(src) + first, n - first);
+    };
+
+    // Mark the reservation first: if this process dies before committing, the
+    // consumer can still step over exactly this record
+    wordAt(pos + sizeof(uint64_t))->store(length | (static_cast<uint64_t>(CurrentPid()) << 32), std::memory_order_relaxed);
+    wordAt(pos)->store(pos | TAG_RESERVED, std::memory_order_release);
+
+    RecordHeader rec{ 0, static_cast<uint32_t>(length), CurrentPid(), eventId, senderNode, static_cast<uint32_t>(size), 0 };
+    const size_t fieldsAt = offsetof(RecordHeader, eventId);
+    copyIn(pos + fieldsAt, reinterpret_cast<const char*>(&rec) + fieldsAt, sizeof(RecordHeader) - fieldsAt);
+    if (size)
+        copyIn(pos + sizeof(RecordHeader), data, size);
+    wordAt(pos)->store(pos | TAG_COMMITTED, std::memory_order_release);
+
+    // Pairs with the fence in Wait: either we see the sleeper or it sees our record
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (slot.sleeping.load(std::memory_order_relaxed))
+        Wake(index);
+    return true;
+}
+
+void ShmSegment::Wake(uint32_t index)
+{
+    Slot& slot = header_->slots[index];
+    slot.wakeSeq.fetch_add(1, std::memory_order_release);
+#ifdef _WIN32
+    std::string eventName = "Local\\" + name_ + ".wake" + std::to_string(index);
+    HANDLE evt = OpenEventA(EVENT_MODIFY_STATE, FALSE, eventName.c_str());
+    if (evt)
+    {
+        SetEvent(evt);
+        CloseHandle(evt);
+    }
+#else
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&slot.wakeSeq), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif
+}
+
+// ============================================================
+// Consumer side (receiver thread only)
+// ============================================================
+size_t ShmSegment::Drain(const RecordVisitor& visit)
+{
+    if (!header_ || self_ < 0)
+        return 0;
+    Slot& slot = header_->slots[self_];
+    const uint64_t ring = RingBytes();
+    char* base = RingOf(static_cast<uint32_t>(self_));
+    auto copyOut = [&](uint64_t at, void* dst, size_t n) {
+        size_t offset = static_cast<size_t>(at % ring);
+        size_t first = (std::min)(n, static_cast<size_t>(ring) - offset);
+        memcpy(dst, base + offset, first);
+        if (first < n)
+            memcpy(static_cast<char*>(dst) + first, base, n - first);
+    };
+
+    size_t consumed = 0;
+    uint64_t tail = slot.tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (reinterpret_cast<std::atomic<uint64_t>*>(base + tail % ring)->load(std::memory_order_acquire) != (tail | TAG_COMMITTED))
+        {
+            if (SkipStalled(tail))
+                continue;
+            break;
+        }
+
+        RecordHeader rec;
+        copyOut(tail, &rec, sizeof(rec));
+        if (rec.length < sizeof(RecordHeader) || rec.length > ring / 4 || rec.size > rec.length - sizeof(RecordHeader))
+        {
+            fprintf(stderr, "[ShmEventBus] Corrupt record in inbox; skipping to head\n");
+            slot.tail.store(slot.head.load(std::memory_order_acquire), std::memory_order_release);
+            break;
+        }
+        readBuffer_.resize(rec.size);
+        if (rec.size)
+            copyOut(tail + sizeof(RecordHeader), &readBuffer_[0], rec.size);
+
+        // Free the space before dispatching so producers are never held up by callbacks
+        tail += rec.length;
+        slot.tail.store(tail, std::memory_order_release);
+        visit(rec.eventId, rec.senderNode, readBuffer_.data(), rec.size);
+        ++consumed;
+    }
+    return consumed;
+}
+
+bool ShmSegment::SkipStalled(uint64_t& tail)
+{
+    Slot& slot = header_->slots[self_];
+    const uint64_t head = slot.head.load(std::memory_order_acquire);
+    if (head == tail)
+    {
+        stallTail_ = UINT64_MAX; // empty, nothing stalled
+        return false;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (stallTail_ != tail)
+    {
+        stallTail_ = tail;
+        stallSince_ = now;
+    }
+    const bool timedOut = now - stallSince_ >= std::chrono::milliseconds(STALL_TIMEOUT_MS);
+
+    const uint64_t ring = RingBytes();
+    char* base = RingOf(static_cast<uint32_t>(self_));
+    uint64_t next = 0;
+    if (reinterpret_cast<std::atomic<uint64_t>*>(base + tail % ring)->load(std::memory_order_acquire) == (tail | TAG_RESERVED))
+    {
+        // Length and pid are valid: step over just this record once its producer is gone
+        const uint64_t word = reinterpret_cast<std::atomic<uint64_t>*>(base + (tail + sizeof(uint64_t)) % ring)->load(std::memory_order_relaxed);
+        const uint64_t length = word & 0xFFFFFFFFu;
+        if (!timedOut && IsProcessAlive(static_cast<uint32_t>(word >> 32)))
+            return false;
+        if (length >= sizeof(RecordHeader) && length <= ring / 4 && tail + length <= head)
+            next = tail + length;
+    }
+    if (next == 0)
+    {
+        // Died before marking its reservation: its length is unknown
+        if (!timedOut)
+            return false;
+        next = head;
+    }
+
+    fprintf(stderr, "[ShmEventBus] Skipping %llu bytes of an uncommitted record in inbox\n", static_cast<unsigned long long>(next - tail));
+    slot.tail.store(next, std::memory_order_release);
+    tail = next;
+    stallTail_ = UINT64_MAX;
+    ++skipped_;
+    return true;
+}
+
+void ShmSegment::Wait(std::chrono::milliseconds timeout)
+{
+    if (!header_ || self_ < 0)
+        return;
+    Slot& slot = header_->slots[self_];
+    char* base = RingOf(static_cast<uint32_t>(self_));
+    uint64_t tail = slot.tail.load(std::memory_order_relaxed);
+
+    uint32_t seq = slot.wakeSeq.load(std::memory_order_acquire);
+    slot.sleeping.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool pending = reinterpret_cast<std::atomic<uint64_t>*>(base + tail % RingBytes())->load(std::memory_order_acquire) == (tail | 1);
+    if (!pending)
+    {
+#ifdef _WIN32
+        (void)seq;
+        if (wakeEvent_)
+            WaitForSingleObject(static_cast<HANDLE>(wakeEvent_), static_cast<DWORD>(timeout.count()));
+#else
+        timespec ts{ static_cast<time_t>(timeout.count() / 1000), static_cast<long>((timeout.count() % 1000) * 1000000) };
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&slot.wakeSeq), FUTEX_WAIT, seq, &ts, nullptr, 0);
+#endif
+    }
+    slot.sleeping.store(0, std::memory_order_relaxed);
+}
+
+// ============================================================
+// Process helpers
+// ============================================================
+uint32_t ShmSegment::CurrentPid()
+{
+#ifdef _WIN32
+    return static_cast<uint32_t>(GetCurrentProcessId());
+#else
+    return static_cast<uint32_t>(getpid());
+#endif
+}
+
+bool ShmSegment::IsProcessAlive(uint32_t pid)
+{
+#ifdef _WIN32
+    HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, pid);
+    if (!process)
+        return GetLastError() == ERROR_ACCESS_DENIED;
+    bool alive = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+    CloseHandle(process);
+    return alive;
+#else
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
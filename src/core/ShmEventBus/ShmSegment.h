@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// ShmSegment - named shared-memory segment holding one inbox ring per process.
+//
+// Layout: [header + MAX_PROCESSES slots][ring 0][ring 1]...[ring N-1]
+//
+// Each attached process owns one slot and consumes its ring; every other
+// process may write into it (MPSC). Producers reserve space with a CAS on
+// the slot's head (never past the consumer's tail, so a full inbox drops the
+// event instead of blocking), mark the reservation with its length and their
+// pid, and commit by storing the record tag last. A reservation whose
+// producer died, or that stays uncommitted for STALL_TIMEOUT_MS, is skipped
+// so one crashed producer cannot wedge the inbox.
+// Wakeups only cost a syscall when the consumer is actually asleep: a futex
+// on the slot's wake word on Linux, a named auto-reset event on Windows
+// (futexes do not cross process boundaries there).
+class ShmSegment
+{
+public:
+    static constexpr uint32_t MAX_PROCESSES = 16;
+    static constexpr int64_t STALL_TIMEOUT_MS = 2000;
+
+    ShmSegment() = default;
+    ~ShmSegment();
+
+    ShmSegment(const ShmSegment&) = delete;
+    ShmSegment& operator=(const ShmSegment&) = delete;
+
+    // Map (creating if needed) the named segment. Fails if an existing segment
+    // was created with a different ring size.
+    bool Open(const char* name, size_t ringBytes);
+    void Close();
+    bool IsOpen() const { return header_ != nullptr; }
+
+    // Claim a free slot (reclaiming slots of dead processes). Returns false if full.
+    bool Attach(uint64_t nodeId);
+    void Detach();
+
+    // Copy one record into every other attached process's inbox.
+    // Returns the number of inboxes that were full and dropped it.
+    uint32_t Broadcast(uint64_t eventId, uint64_t senderNode, const char* data, size_t size);
+
+    // Consume all committed records in our inbox; returns the number consumed.
+    // Also skips a stalled reservation at the front (counted in SkippedCount).
+    using RecordVisitor = std::function<void(uint64_t eventId, uint64_t senderNode, const char* data, size_t size)>;
+    size_t Drain(const RecordVisitor& visit);
+
+    // Sleep until a producer signals our inbox or `timeout` elapses
+    void Wait(std::chrono::milliseconds timeout);
+
+    // Largest payload accepted (a quarter of the ring)
+    size_t MaxPayload() const;
+
+    // Reservations in our inbox skipped because they never committed
+    uint64_t SkippedCount() const { return skipped_; }
+
+private:
+    struct Slot;
+    struct Header;
+    struct RecordHeader;
+
+    uint64_t RingBytes() const;
+    char* RingOf(uint32_t slot) const;
+    bool Write(uint32_t slot, uint64_t eventId, uint64_t senderNode, const char* data, size_t size);
+    bool SkipStalled(uint64_t& tail);
+    void Wake(uint32_t slot);
+    static bool IsProcessAlive(uint32_t pid);
+    static uint32_t CurrentPid();
+
+    Header* header_ = nullptr;
+    size_t mappedSize_ = 0;
+    int32_t self_ = -1;
+    std::string name_;
+    std::string readBuffer_;
+
+    // Consumer side: the uncommitted reservation at the front of our inbox
+    uint64_t stallTail_ = UINT64_MAX;
+    std::chrono::steady_clock::time_point stallSince_;
+    uint64_t skipped_ = 0;
+#ifdef _WIN32
+    void* mapping_ = nullptr;
+    void* wakeEvent_ = nullptr; // our slot's named wake event
+#endif
+};
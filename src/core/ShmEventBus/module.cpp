@@ -0,0 +1,5 @@
+#include "ShmEventBusImpl.h"
+#include "AxPlug/AxAutoRegister.h"
+
+AX_AUTO_REGISTER_SERVICE(ShmEventBusImpl, AxPlug::IShmEventBus)
+AX_DEFINE_PLUGIN_ENTRY()
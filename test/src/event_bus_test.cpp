@@ -1,13 +1,22 @@
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <thread>
+#include <algorithm>
 #include <atomic>
 #include <string>
 #include <vector>
+#include <winsock2.h>
+#include <ws2tcpip.h>
 #include <windows.h>
 
 #include "AxPlug/AxPlug.h"
+#include "AxPlug/WinsockInit.hpp"
 #include "core/INetworkEventBus.h"
+#include "core/IShmEventBus.h"
 
 // ============================================================
 // Test event definitions
@@ -33,6 +42,31 @@ public:
     void Deserialize(const std::string& data) override { payload = data; }
 };
 
+// A networkable event serialized through spans (no intermediate std::string)
+class SpanTestEvent : public AxPlug::INetworkableEventV2
+{
+public:
+    int32_t x = 0;
+    int32_t y = 0;
+
+    size_t SerializedSizeHint() const override { return 8; }
+    size_t SerializeTo(uint8_t* out, size_t capacity) const override
+    {
+        if (capacity < 8)
+            return SERIALIZE_OVERFLOW;
+        memcpy(out, &x, 4);
+        memcpy(out + 4, &y, 4);
+        return 8;
+    }
+    void DeserializeFrom(const uint8_t* data, size_t size) override
+    {
+        if (size < 8)
+            return;
+        memcpy(&x, data, 4);
+        memcpy(&y, data + 4, 4);
+    }
+};
+
 // ============================================================
 // Test counters
 // ============================================================
@@ -262,6 +296,63 @@ void testNetworkEventBusTakeover()
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
         TEST_CHECK(netCount.load() == 1, "Loopback correctly filtered (no duplicate from self)");
 
+        // Larger than one datagram: goes out as fragments instead of being dropped
+        auto bigEvt = std::make_shared<NetworkTestEvent>();
+        bigEvt->payload.assign(200 * 1024, 'x');
+        auto before = netBus->GetTransportStats();
+        AxPlug::Publish(EVENT_TEST_NETWORK, bigEvt);
+        auto after = netBus->GetTransportStats();
+        TEST_CHECK(after.fragmentedSent == before.fragmentedSent + 1 && after.fragmentsSent >= before.fragmentsSent + 4, "Large event sent as fragments");
+        TEST_CHECK(after.oversizeDrops == before.oversizeDrops, "Large event not dropped");
+
+        // Batching: small events share datagrams, flushed by size or delay
+        netBus->SetBatching(1472, std::chrono::microseconds(200));
+        before = netBus->GetTransportStats();
+        for (int i = 0; i < 20; ++i)
+        {
+            auto smallEvt = std::make_shared<NetworkTestEvent>();
+            smallEvt->payload = "t" + std::to_string(i);
+            AxPlug::Publish(EVENT_TEST_NETWORK, smallEvt);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        after = netBus->GetTransportStats();
+        TEST_CHECK(after.batchedEvents == before.batchedEvents + 20, "Small events coalesced into batches");
+        TEST_CHECK(after.batchesSent - before.batchesSent < 20, "Batches carry several events each");
+        netBus->SetBatching(0, std::chrono::microseconds(0));
+
+        // Reliable delivery: sequenced sends, nothing to repair without a peer
+        netBus->SetReliableDelivery(4 * 1024 * 1024);
+        before = netBus->GetTransportStats();
+        AxPlug::Publish(EVENT_TEST_NETWORK, netEvt);
+        after = netBus->GetTransportStats();
+        TEST_CHECK(after.retransmits == before.retransmits && after.datagramsLost == before.datagramsLost, "Reliable send without loss");
+        netBus->SetReliableDelivery(0);
+
+        // Token bucket: burst of 2, then throttled (still delivered locally)
+        TEST_CHECK(netBus->SetRateLimit(EVENT_TEST_NETWORK, 1.0, 2), "Rate limit set");
+        before = netBus->GetTransportStats();
+        int localBefore = netCount.load();
+        for (int i = 0; i < 5; ++i)
+            AxPlug::Publish(EVENT_TEST_NETWORK, netEvt);
+        after = netBus->GetTransportStats();
+        TEST_CHECK(after.throttled - before.throttled >= 3, "Broadcasts beyond the burst are throttled");
+        TEST_CHECK(netCount.load() == localBefore + 5, "Throttled events still delivered locally");
+        netBus->SetRateLimit(EVENT_TEST_NETWORK, 0, 0);
+
+        // Interest filtering: no peer advertises the eventId, so once the start-up
+        // grace is over nothing is serialized or sent (still delivered locally)
+        TEST_CHECK(after.interestAdverts >= 1, "Subscribed eventIds advertised");
+        netBus->SetInterestFiltering(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        before = netBus->GetTransportStats();
+        localBefore = netCount.load();
+        for (int i = 0; i < 3; ++i)
+            AxPlug::Publish(EVENT_TEST_NETWORK, netEvt);
+        after = netBus->GetTransportStats();
+        TEST_CHECK(after.uninterestedSkipped > before.uninterestedSkipped, "Events no peer wants are not broadcast");
+        TEST_CHECK(netCount.load() == localBefore + 3, "Skipped events still delivered locally");
+        netBus->SetInterestFiltering(false);
+
         // Stop network
         netBus->StopNetwork();
         TEST_CHECK(!netBus->IsNetworkActive(), "Network stopped successfully");
@@ -327,6 +418,1137 @@ void testAntiStormWhitelist()
     std::cout << "=== Test 8 Complete ===" << std::endl;
 }
 
+// ============================================================
+// Test 9: Pooled event payloads (MakeEvent / Publish<T>)
+// ============================================================
+void testPooledEvents()
+{
+    std::cout << "\n=== Test 9: Pooled Event Payloads ===" << std::endl;
+
+    std::atomic<int> callCount{0};
+    std::atomic<int> lastValue{0};
+    auto conn = AxPlug::Subscribe(EVENT_TEST_LOCAL, [&](std::shared_ptr<AxPlug::AxEvent> evt) {
+        auto local = std::dynamic_pointer_cast<LocalTestEvent>(evt);
+        if (local)
+        {
+            lastValue.store(local->value);
+            callCount.fetch_add(1);
+        }
+    });
+
+    auto ev = AxPlug::MakeEvent<LocalTestEvent>();
+    ev->value = 7;
+    AxPlug::Publish(EVENT_TEST_LOCAL, ev);
+    TEST_CHECK(callCount.load() == 1 && lastValue.load() == 7, "Pooled payload delivered via Publish");
+
+    // Release the payload: its block goes back to the pool and is handed out again
+    const void* firstBlock = ev.get();
+    ev.reset();
+    auto reused = AxPlug::MakeEvent<LocalTestEvent>();
+    TEST_CHECK(reused.get() == firstBlock, "Released payload block is recycled by the pool");
+    reused.reset();
+
+    AxPlug::Publish<LocalTestEvent>(EVENT_TEST_LOCAL);
+    TEST_CHECK(callCount.load() == 2 && lastValue.load() == 0, "Publish<T>() constructs and dispatches a pooled payload");
+
+    std::cout << "=== Test 9 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 10: Batch publish (DirectCall + Queued)
+// ============================================================
+void testPublishBatch()
+{
+    std::cout << "\n=== Test 10: Batch Publish ===" << std::endl;
+
+    std::vector<int> received;
+    std::atomic<int> callCount{0};
+    auto conn = AxPlug::Subscribe(EVENT_TEST_LOCAL, [&](std::shared_ptr<AxPlug::AxEvent> evt) {
+        auto local = std::dynamic_pointer_cast<LocalTestEvent>(evt);
+        if (local)
+            received.push_back(local->value);
+        callCount.fetch_add(1);
+    });
+
+    std::vector<std::shared_ptr<AxPlug::AxEvent>> batch;
+    for (int i = 0; i < 5; ++i)
+    {
+        auto ev = AxPlug::MakeEvent<LocalTestEvent>();
+        ev->value = i;
+        batch.push_back(ev);
+    }
+
+    AxPlug::PublishBatch(EVENT_TEST_LOCAL, batch);
+    TEST_CHECK(callCount.load() == 5, "DirectCall batch delivered every payload");
+    TEST_CHECK(received == std::vector<int>({ 0, 1, 2, 3, 4 }), "DirectCall batch preserved publish order");
+
+    AxPlug::PublishBatch(EVENT_TEST_LOCAL, batch, AxPlug::DispatchMode::Queued);
+    for (int i = 0; i < 100 && callCount.load() < 10; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(callCount.load() == 10, "Queued batch delivered every payload");
+
+    std::cout << "=== Test 10 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 11: Subscriber-thread delivery (EventMailbox)
+// ============================================================
+void testMailboxDelivery()
+{
+    std::cout << "\n=== Test 11: Subscriber-Thread Delivery (Mailbox) ===" << std::endl;
+
+    auto mailbox = std::make_shared<AxPlug::EventMailbox>(64);
+    std::atomic<int> callCount{0};
+    std::atomic<DWORD> callbackThreadId{0};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> subscribed{false};
+    AxPlug::EventConnectionPtr conn;
+
+    // Owner thread: subscribes and runs its own loop draining the mailbox
+    std::thread owner([&]() {
+        conn = AxPlug::SubscribeOn(EVENT_TEST_LOCAL, mailbox, [&](std::shared_ptr<AxPlug::AxEvent>) {
+            callbackThreadId.store(GetCurrentThreadId());
+            callCount.fetch_add(1);
+        });
+        subscribed.store(true);
+        while (!stop.load())
+        {
+            mailbox->WaitFor(std::chrono::milliseconds(10));
+            mailbox->Drain();
+        }
+    });
+    while (!subscribed.load())
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    AxPlug::Publish(EVENT_TEST_LOCAL, std::make_shared<LocalTestEvent>());
+    AxPlug::Publish(EVENT_TEST_LOCAL, std::make_shared<LocalTestEvent>(), AxPlug::DispatchMode::Queued);
+    for (int i = 0; i < 100 && callCount.load() < 2; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    TEST_CHECK(callCount.load() == 2, "Mailbox subscriber received DirectCall and Queued events");
+    DWORD ownerThreadId = callbackThreadId.load();
+    TEST_CHECK(ownerThreadId != 0 && ownerThreadId != GetCurrentThreadId(), "Mailbox callback ran on the owner thread");
+
+    conn->Disconnect();
+    AxPlug::Publish(EVENT_TEST_LOCAL, std::make_shared<LocalTestEvent>());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TEST_CHECK(callCount.load() == 2, "Mailbox callback NOT invoked after disconnect");
+
+    stop.store(true);
+    owner.join();
+
+    std::cout << "=== Test 11 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 12: Inline handlers with const& payload
+// ============================================================
+void testInlineHandlers()
+{
+    std::cout << "\n=== Test 12: Inline Handlers (const& payload) ===" << std::endl;
+
+    TEST_CHECK(AxPlug::EventHandler::StoresInline<AxPlug::EventCallback>, "EventCallback fits the inline buffer");
+
+    // Move-only capture: not possible with std::function
+    auto counter = std::make_unique<std::atomic<int>>(0);
+    auto* counterPtr = counter.get();
+    long maxUseCount = 0;
+    std::vector<AxPlug::EventConnectionPtr> conns;
+    for (int i = 0; i < 50; ++i)
+    {
+        conns.push_back(AxPlug::Subscribe(EVENT_TEST_LOCAL, [&maxUseCount, counterPtr](const std::shared_ptr<AxPlug::AxEvent>& e) {
+            counterPtr->fetch_add(1);
+            maxUseCount = (std::max)(maxUseCount, static_cast<long>(e.use_count()));
+        }));
+    }
+    conns.push_back(AxPlug::Subscribe(EVENT_TEST_LOCAL, [c = std::move(counter)](const std::shared_ptr<AxPlug::AxEvent>&) {
+        c->fetch_add(1);
+    }));
+
+    auto evt = std::make_shared<LocalTestEvent>();
+    long baseUseCount = evt.use_count();
+    AxPlug::Publish(EVENT_TEST_LOCAL, evt);
+
+    TEST_CHECK(counterPtr->load() == 51, "All 51 inline handlers invoked");
+    // Publish() takes the payload by value once; subscribers add no further references
+    TEST_CHECK(maxUseCount <= baseUseCount + 1, "Payload not copied per subscriber");
+
+    conns.clear();
+    std::cout << "=== Test 12 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 13: Priority lanes for queued events
+// ============================================================
+void testPriorityLanes()
+{
+    std::cout << "\n=== Test 13: Priority Lanes ===" << std::endl;
+
+    const uint64_t EVENT_TEST_BLOCKER = AxPlug::HashEventId("Test::PriorityBlocker");
+    std::atomic<bool> release{false};
+    std::mutex orderMutex;
+    std::vector<int> order;
+
+    // Hold the event loop so the lanes fill up behind it
+    auto blockConn = AxPlug::Subscribe(EVENT_TEST_BLOCKER, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        while (!release.load())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    auto conn = AxPlug::Subscribe(EVENT_TEST_LOCAL, [&](const std::shared_ptr<AxPlug::AxEvent>& e) {
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(static_cast<LocalTestEvent&>(*e).value);
+    });
+
+    AxPlug::Publish(EVENT_TEST_BLOCKER, std::make_shared<LocalTestEvent>(), AxPlug::DispatchMode::Queued);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    for (int i = 0; i < 20; ++i)
+    {
+        auto evt = std::make_shared<LocalTestEvent>();
+        evt->value = 200 + i;
+        AxPlug::Publish(EVENT_TEST_LOCAL, evt, AxPlug::DispatchMode::Queued, AxPlug::EventPriority::Bulk);
+    }
+    for (int i = 0; i < 20; ++i)
+    {
+        auto evt = std::make_shared<LocalTestEvent>();
+        evt->value = 100 + i;
+        AxPlug::Publish(EVENT_TEST_LOCAL, evt, AxPlug::DispatchMode::Queued);
+    }
+    auto control = std::make_shared<LocalTestEvent>();
+    control->value = 1;
+    AxPlug::Publish(EVENT_TEST_LOCAL, control, AxPlug::DispatchMode::Queued, AxPlug::EventPriority::Critical);
+
+    release.store(true);
+    for (int i = 0; i < 100; ++i)
+    {
+        {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            if (order.size() == 41)
+                break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::lock_guard<std::mutex> lock(orderMutex);
+    TEST_CHECK(order.size() == 41, "All queued events delivered");
+    TEST_CHECK(!order.empty() && order.front() == 1, "Critical event jumped ahead of queued data");
+    auto firstBulk = std::find_if(order.begin(), order.end(), [](int v) { return v >= 200; });
+    auto lastNormal = std::find_if(order.rbegin(), order.rend(), [](int v) { return v >= 100 && v < 200; });
+    TEST_CHECK(firstBulk != order.end() && lastNormal != order.rend() && firstBulk < lastNormal.base(), "Bulk lane not starved by Normal lane");
+
+    std::cout << "=== Test 13 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 14: Delayed and periodic publishing (timer wheel)
+// ============================================================
+void testTimedPublish()
+{
+    std::cout << "\n=== Test 14: Timed Publish (PublishAfter / PublishEvery) ===" << std::endl;
+
+    const uint64_t EVENT_TEST_TICK = AxPlug::HashEventId("Test::Tick");
+    const uint64_t EVENT_TEST_TIMEOUT = AxPlug::HashEventId("Test::Timeout");
+    std::atomic<int> ticks{0};
+    std::atomic<int> timeouts{0};
+    std::atomic<long long> delayMs{0};
+
+    auto start = std::chrono::steady_clock::now();
+    auto tickConn = AxPlug::Subscribe(EVENT_TEST_TICK, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        ticks.fetch_add(1);
+    });
+    auto timeoutConn = AxPlug::Subscribe(EVENT_TEST_TIMEOUT, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        delayMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+        timeouts.fetch_add(1);
+    });
+
+    auto once = AxPlug::PublishAfter(std::chrono::milliseconds(50), EVENT_TEST_TIMEOUT, std::make_shared<LocalTestEvent>());
+    auto cancelled = AxPlug::PublishAfter(std::chrono::milliseconds(30), EVENT_TEST_TIMEOUT, std::make_shared<LocalTestEvent>());
+    auto periodic = AxPlug::PublishEvery(std::chrono::milliseconds(20), EVENT_TEST_TICK, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(once && cancelled && periodic, "Timer handles returned");
+    cancelled.reset();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    periodic->Disconnect();
+    int ticksAtStop = ticks.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+    TEST_CHECK(timeouts.load() == 1, "PublishAfter fired once; released handle cancelled the other");
+    TEST_CHECK(delayMs.load() >= 50, "PublishAfter did not fire early");
+    TEST_CHECK(ticksAtStop >= 5, "PublishEvery fired periodically");
+    TEST_CHECK(ticks.load() == ticksAtStop, "PublishEvery stopped after Disconnect");
+
+    std::cout << "=== Test 14 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 15: Per-event metrics and latency histograms
+// ============================================================
+void testEventStats()
+{
+    std::cout << "\n=== Test 15: Event Metrics ===" << std::endl;
+
+    const uint64_t EVENT_TEST_METRICS = AxPlug::HashEventId("Test::Metrics");
+    auto fastConn = AxPlug::Subscribe(EVENT_TEST_METRICS, [](const std::shared_ptr<AxPlug::AxEvent>&) {});
+    auto slowConn = AxPlug::Subscribe(EVENT_TEST_METRICS, [](const std::shared_ptr<AxPlug::AxEvent>&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+
+    for (int i = 0; i < 5; ++i)
+        AxPlug::Publish(EVENT_TEST_METRICS, std::make_shared<LocalTestEvent>());
+    for (int i = 0; i < 5; ++i)
+        AxPlug::Publish(EVENT_TEST_METRICS, std::make_shared<LocalTestEvent>(), AxPlug::DispatchMode::Queued);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    AxPlug::EventStats stats;
+    bool found = AxPlug::GetEventBus()->GetEventStats(EVENT_TEST_METRICS, stats);
+    TEST_CHECK(found, "Stats available for published eventId");
+    TEST_CHECK(stats.publishes == 10, "Publish counter");
+    TEST_CHECK(stats.deliveries == 20, "Delivery counter");
+    TEST_CHECK(stats.subscribers == 2, "Subscriber count");
+    TEST_CHECK(stats.callback.count == 20 && stats.callback.p99Ns >= 2000000, "Callback histogram sees the slow subscriber");
+    TEST_CHECK(stats.queueWait.count == 5, "Queue wait recorded for queued publishes");
+    std::cout << "  callback p50=" << stats.callback.p50Ns << "ns p99=" << stats.callback.p99Ns << "ns, queue wait p99=" << stats.queueWait.p99Ns << "ns" << std::endl;
+
+    TEST_CHECK(!AxPlug::GetEventBus()->GetEventStats(AxPlug::HashEventId("Test::NeverSeen"), stats), "Unknown eventId has no stats");
+
+    std::cout << "=== Test 15 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 16: Per-sender subscriber index
+// ============================================================
+void testSenderIndex()
+{
+    std::cout << "\n=== Test 16: Sender Index ===" << std::endl;
+
+    const uint64_t EVENT_TEST_SENDER = AxPlug::HashEventId("Test::SenderIndex");
+    int senderA = 0, senderB = 0;
+    std::atomic<int> anyCount{ 0 }, aCount{ 0 }, bCount{ 0 };
+    std::vector<int> order;
+
+    auto anyConn = AxPlug::Subscribe(EVENT_TEST_SENDER, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        anyCount++;
+        order.push_back(0);
+    });
+    auto aConn = AxPlug::Subscribe(EVENT_TEST_SENDER, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        aCount++;
+        order.push_back(1);
+    }, &senderA);
+    auto bConn = AxPlug::Subscribe(EVENT_TEST_SENDER, [&](const std::shared_ptr<AxPlug::AxEvent>&) { bCount++; }, &senderB);
+
+    auto fromA = std::make_shared<LocalTestEvent>();
+    fromA->sender = &senderA;
+    AxPlug::Publish(EVENT_TEST_SENDER, fromA);
+    TEST_CHECK(anyCount == 1 && aCount == 1 && bCount == 0, "Only wildcard and matching sender invoked");
+    TEST_CHECK(order.size() == 2 && order[0] == 0 && order[1] == 1, "Wildcard subscribers run before sender-specific ones");
+
+    AxPlug::Publish(EVENT_TEST_SENDER, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(anyCount == 2 && aCount == 1 && bCount == 0, "Sender-less payload reaches wildcard subscribers only");
+
+    // Null payloads carry no sender: wildcard subscribers only, on both paths
+    AxPlug::Publish(EVENT_TEST_SENDER, nullptr, AxPlug::DispatchMode::DirectCall);
+    TEST_CHECK(anyCount == 3 && aCount == 1 && bCount == 0, "Null payload dispatched directly");
+    AxPlug::Publish(EVENT_TEST_SENDER, nullptr, AxPlug::DispatchMode::Queued);
+    for (int i = 0; i < 100 && anyCount < 4; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(anyCount == 4 && aCount == 1 && bCount == 0, "Null payload dispatched through the queue");
+
+    aConn->Disconnect();
+    AxPlug::Publish(EVENT_TEST_SENDER, fromA);
+    TEST_CHECK(anyCount == 5 && aCount == 1, "Disconnected sender-specific subscriber skipped");
+
+    AxPlug::EventStats stats;
+    AxPlug::GetEventBus()->GetEventStats(EVENT_TEST_SENDER, stats);
+    TEST_CHECK(stats.subscribers == 2, "Stats count subscribers across both indexes");
+
+    std::cout << "=== Test 16 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 17: Hierarchical topics and pattern subscriptions
+// ============================================================
+void testTopicPatterns()
+{
+    std::cout << "\n=== Test 17: Topic Patterns ===" << std::endl;
+
+    const uint64_t EVENT_CAMERA_FRAME = AxPlug::RegisterTopic("TestCamera::Frame");
+    TEST_CHECK(EVENT_CAMERA_FRAME == AxPlug::HashEventId("TestCamera::Frame"), "Topic ID equals HashEventId");
+
+    std::atomic<int> cameraCount{ 0 }, frameCount{ 0 };
+    auto cameraConn = AxPlug::SubscribePattern("TestCamera::*", [&](const std::shared_ptr<AxPlug::AxEvent>&) { cameraCount++; });
+    auto frameConn = AxPlug::SubscribePattern("TestCamera::Frame::*", [&](const std::shared_ptr<AxPlug::AxEvent>&) { frameCount++; });
+    TEST_CHECK(cameraConn != nullptr && frameConn != nullptr, "Pattern subscriptions created");
+    TEST_CHECK(AxPlug::SubscribePattern("TestCam*", [](const std::shared_ptr<AxPlug::AxEvent>&) {}) == nullptr, "Wildcard must be a whole trailing level");
+
+    AxPlug::Publish(EVENT_CAMERA_FRAME, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(cameraCount == 1 && frameCount == 0, "Prefix pattern matches registered child topic");
+
+    // Topics registered after the subscription are picked up
+    const uint64_t EVENT_CAMERA_RAW = AxPlug::RegisterTopic("TestCamera::Frame::Raw");
+    AxPlug::Publish(EVENT_CAMERA_RAW, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(cameraCount == 2 && frameCount == 1, "Later topic matches all ancestor patterns");
+
+    AxPlug::Publish(AxPlug::HashEventId("TestCamera::Unregistered"), std::make_shared<LocalTestEvent>());
+    TEST_CHECK(cameraCount == 2, "Unregistered topic is not matched");
+
+    cameraConn.reset();
+    AxPlug::Publish(EVENT_CAMERA_RAW, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(cameraCount == 2 && frameCount == 2, "Released pattern subscription stops receiving");
+
+    std::cout << "=== Test 17 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 18: Memory-mapped event journal and replay
+// ============================================================
+void testEventJournal()
+{
+    std::cout << "\n=== Test 18: Event Journal ===" << std::endl;
+
+    const char* journalPath = "event_bus_test.journal";
+    const uint64_t EVENT_TEST_JOURNAL = AxPlug::HashEventId("Test::Journal");
+    std::remove(journalPath);
+
+    TEST_CHECK(AxPlug::OpenJournal(journalPath, 1 << 20), "Journal opened");
+    TEST_CHECK(AxPlug::JournalEvent(EVENT_TEST_JOURNAL, []() { return std::make_shared<NetworkTestEvent>(); }), "Event type opted in");
+
+    auto from = std::chrono::system_clock::now();
+    for (int i = 0; i < 10; ++i)
+    {
+        auto evt = std::make_shared<NetworkTestEvent>();
+        evt->payload = "journal-" + std::to_string(i);
+        AxPlug::Publish(EVENT_TEST_JOURNAL, evt);
+    }
+    AxPlug::Publish(EVENT_TEST_JOURNAL, std::make_shared<LocalTestEvent>()); // not networkable: not recorded
+    auto to = std::chrono::system_clock::now();
+
+    std::vector<std::string> replayed;
+    auto conn = AxPlug::Subscribe(EVENT_TEST_JOURNAL, [&](const std::shared_ptr<AxPlug::AxEvent>& evt) {
+        if (auto net = std::dynamic_pointer_cast<NetworkTestEvent>(evt))
+            replayed.push_back(net->payload);
+    });
+
+    size_t count = AxPlug::ReplayJournal(from, to);
+    TEST_CHECK(count == 10 && replayed.size() == 10, "All journaled events replayed");
+    TEST_CHECK(!replayed.empty() && replayed.front() == "journal-0" && replayed.back() == "journal-9", "Replay preserves order and payload");
+
+    // Replayed events are not journaled a second time
+    replayed.clear();
+    AxPlug::ReplayJournal(from, std::chrono::system_clock::now());
+    TEST_CHECK(replayed.size() == 10, "Replay does not re-record events");
+
+    replayed.clear();
+    TEST_CHECK(AxPlug::ReplayJournal(to + std::chrono::seconds(1), to + std::chrono::seconds(2)) == 0, "Empty window replays nothing");
+
+    // Crash mid-append: space reserved (cursor at byte 24 of the file header
+    // advanced) but the record never committed. Reopening drops the torn
+    // record, and records appended afterwards still replay.
+    AxPlug::GetEventBus()->CloseJournal();
+    if (FILE* f = fopen(journalPath, "r+b"))
+    {
+        uint64_t cursor = 0;
+        fseek(f, 24, SEEK_SET);
+        fread(&cursor, sizeof(cursor), 1, f);
+        cursor += 64;
+        fseek(f, 24, SEEK_SET);
+        fwrite(&cursor, sizeof(cursor), 1, f);
+        fclose(f);
+    }
+    TEST_CHECK(AxPlug::OpenJournal(journalPath, 1 << 20), "Journal reopened after torn record");
+    for (int i = 10; i < 13; ++i)
+    {
+        auto evt = std::make_shared<NetworkTestEvent>();
+        evt->payload = "journal-" + std::to_string(i);
+        AxPlug::Publish(EVENT_TEST_JOURNAL, evt);
+    }
+    replayed.clear();
+    count = AxPlug::ReplayJournal(from, std::chrono::system_clock::now());
+    TEST_CHECK(count == 13 && replayed.size() == 13 && replayed.back() == "journal-12", "Replay continues past a torn record");
+
+    // A subscriber closing the journal mid-replay must not wait on the replay
+    // it runs inside: the close takes effect once ReplayJournal returns
+    bool reopened = true;
+    auto closer = AxPlug::Subscribe(EVENT_TEST_JOURNAL, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        AxPlug::GetEventBus()->CloseJournal();
+        reopened = AxPlug::OpenJournal(journalPath, 1 << 20);
+    });
+    replayed.clear();
+    count = AxPlug::ReplayJournal(from, std::chrono::system_clock::now());
+    TEST_CHECK(count == 1 && replayed.size() == 1, "Close from a replay callback stops the replay");
+    TEST_CHECK(!reopened, "Open from a replay callback is refused");
+    TEST_CHECK(AxPlug::ReplayJournal(from, std::chrono::system_clock::now()) == 0, "Journal closed after the replay returned");
+    closer->Disconnect();
+
+    AxPlug::GetEventBus()->CloseJournal();
+    std::remove(journalPath);
+
+    std::cout << "=== Test 18 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 19: Shared-memory IPC bus takeover and restore
+// ============================================================
+void testShmEventBusTakeover()
+{
+    std::cout << "\n=== Test 19: ShmEventBus Takeover & Restore ===" << std::endl;
+
+    auto* originalBus = AxPlug::GetEventBus();
+    auto shmBus = AxPlug::GetService<AxPlug::IShmEventBus>();
+    if (!shmBus)
+    {
+        std::cout << "  [SKIP] ShmEventBusPlugin not loaded (DLL not found)" << std::endl;
+        return;
+    }
+
+    TEST_CHECK(AxPlug::GetEventBus() == shmBus->AsEventBus(), "ShmEventBus took over the global bus");
+
+    shmBus->RegisterNetworkableEvent(EVENT_TEST_NETWORK, []() { return std::make_shared<NetworkTestEvent>(); });
+    std::string segmentName = "AxPlugEventBusTest." + std::to_string(GetCurrentProcessId());
+    bool started = shmBus->StartShm(segmentName.c_str(), 256 * 1024);
+    TEST_CHECK(started && shmBus->IsShmActive(), "Shared-memory segment attached");
+
+    std::atomic<int> netCount{0};
+    auto conn = AxPlug::Subscribe(EVENT_TEST_NETWORK, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        netCount.fetch_add(1);
+    });
+
+    auto evt = std::make_shared<NetworkTestEvent>();
+    evt->payload = "{\"test\":\"hello_shm\"}";
+    AxPlug::Publish(EVENT_TEST_NETWORK, evt);
+    TEST_CHECK(netCount.load() == 1, "Networkable event dispatched locally");
+
+    // A process never writes into its own inbox, so nothing comes back
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    TEST_CHECK(netCount.load() == 1, "No self-delivery through the segment");
+    TEST_CHECK(shmBus->GetDroppedCount() == 0, "No drops without peers");
+
+    shmBus->StopShm();
+    TEST_CHECK(!shmBus->IsShmActive(), "Shared-memory bus stopped");
+
+    conn.reset();
+    shmBus.reset();
+    AxPlug::ReleaseService<AxPlug::IShmEventBus>();
+    TEST_CHECK(AxPlug::GetEventBus() == originalBus, "Original bus restored after ShmEventBus release");
+
+    std::cout << "=== Test 19 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 20: Parallel DirectCall fan-out
+// ============================================================
+void testParallelDispatch()
+{
+    std::cout << "\n=== Test 20: Parallel Dispatch ===" << std::endl;
+
+    const uint64_t EVENT_TEST_PARALLEL = AxPlug::HashEventId("Test::Parallel");
+    std::atomic<int> callCount{0};
+    std::mutex threadsMutex;
+    std::vector<std::thread::id> threads;
+    std::vector<AxPlug::EventConnectionPtr> conns;
+    for (int i = 0; i < 8; ++i)
+    {
+        conns.push_back(AxPlug::Subscribe(EVENT_TEST_PARALLEL, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            {
+                std::lock_guard<std::mutex> lock(threadsMutex);
+                threads.push_back(std::this_thread::get_id());
+            }
+            callCount.fetch_add(1);
+        }));
+    }
+
+    TEST_CHECK(AxPlug::SetParallelDispatch(EVENT_TEST_PARALLEL), "Parallel dispatch enabled");
+    AxPlug::Publish(EVENT_TEST_PARALLEL, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(callCount.load() == 8, "All subscribers ran before Publish returned");
+
+    std::sort(threads.begin(), threads.end());
+    size_t distinct = std::unique(threads.begin(), threads.end()) - threads.begin();
+    if (std::thread::hardware_concurrency() > 1)
+        TEST_CHECK(distinct > 1, "Callbacks spread over more than one thread");
+
+    // A throwing subscriber is isolated exactly like sequential dispatch
+    std::atomic<int> reported{0};
+    AxPlug::SetExceptionHandler([&](const std::exception&) { reported.fetch_add(1); });
+    conns.push_back(AxPlug::Subscribe(EVENT_TEST_PARALLEL, [](const std::shared_ptr<AxPlug::AxEvent>&) {
+        throw std::runtime_error("parallel subscriber failure");
+    }));
+    AxPlug::Publish(EVENT_TEST_PARALLEL, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(callCount.load() == 16 && reported.load() == 1, "Exception isolated in parallel fan-out");
+    AxPlug::SetExceptionHandler(nullptr);
+
+    TEST_CHECK(AxPlug::SetParallelDispatch(EVENT_TEST_PARALLEL, false), "Parallel dispatch disabled");
+    threads.clear();
+    conns.pop_back();
+    AxPlug::Publish(EVENT_TEST_PARALLEL, std::make_shared<LocalTestEvent>());
+    std::sort(threads.begin(), threads.end());
+    distinct = std::unique(threads.begin(), threads.end()) - threads.begin();
+    TEST_CHECK(callCount.load() == 24 && distinct == 1, "Sequential dispatch on the publisher thread again");
+
+    std::cout << "=== Test 20 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 21: Bulk subscribe + background sweeper
+// ============================================================
+void testBulkSubscribe()
+{
+    std::cout << "\n=== Test 21: Bulk Subscribe ===" << std::endl;
+
+    const uint64_t EVENT_TEST_BULK_A = AxPlug::HashEventId("Test::BulkA");
+    const uint64_t EVENT_TEST_BULK_B = AxPlug::HashEventId("Test::BulkB");
+    std::vector<int> order;
+    // Released handlers drop their token; the weak_ptr tells us when the bus freed them
+    auto token = std::make_shared<int>(0);
+    std::weak_ptr<int> watch = token;
+
+    std::vector<AxPlug::SubscriptionRequest> requests;
+    for (int i = 0; i < 6; ++i)
+    {
+        requests.push_back({ i % 2 ? EVENT_TEST_BULK_B : EVENT_TEST_BULK_A, [&order, i, token](const std::shared_ptr<AxPlug::AxEvent>&) {
+            order.push_back(i);
+        } });
+    }
+    token.reset();
+    auto conns = AxPlug::SubscribeBulk(std::move(requests));
+    TEST_CHECK(conns.size() == 6, "One connection per request");
+
+    AxPlug::Publish(EVENT_TEST_BULK_A, std::make_shared<LocalTestEvent>());
+    AxPlug::Publish(EVENT_TEST_BULK_B, std::make_shared<LocalTestEvent>());
+    TEST_CHECK((order == std::vector<int>{ 0, 2, 4, 1, 3, 5 }), "Per-event subscription order preserved");
+
+    conns.clear();
+    order.clear();
+    AxPlug::Publish(EVENT_TEST_BULK_A, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(order.empty(), "Released bulk subscriptions no longer called");
+
+    // No further publishes on B: only the background sweeper can free its subscribers
+    for (int i = 0; i < 30 && !watch.expired(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    TEST_CHECK(watch.expired(), "Sweeper released expired subscribers of an idle event");
+
+    std::cout << "=== Test 21 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 22: Request / Reply
+// ============================================================
+void testRequestReply()
+{
+    std::cout << "\n=== Test 22: Request / Reply ===" << std::endl;
+
+    const uint64_t EVENT_TEST_QUERY = AxPlug::HashEventId("Test::Query");
+    const uint64_t EVENT_TEST_NOBODY = AxPlug::HashEventId("Test::Nobody");
+
+    auto responder = AxPlug::Subscribe(EVENT_TEST_QUERY, [](const std::shared_ptr<AxPlug::AxEvent>& request) {
+        auto query = std::static_pointer_cast<LocalTestEvent>(request);
+        auto answer = std::make_shared<LocalTestEvent>();
+        answer->value = query->value + 1;
+        AxPlug::Reply(*request, answer);
+    });
+
+    auto query = std::make_shared<LocalTestEvent>();
+    query->value = 41;
+    auto future = AxPlug::Request(EVENT_TEST_QUERY, query, std::chrono::milliseconds(1000));
+    auto reply = std::static_pointer_cast<LocalTestEvent>(future.get());
+    TEST_CHECK(reply && reply->value == 42, "Reply delivered to the waiting future");
+    TEST_CHECK(reply && reply->correlationId == query->correlationId && query->correlationId != 0, "Reply carries the request's correlationId");
+    TEST_CHECK(!AxPlug::Reply(*query, std::make_shared<LocalTestEvent>()), "Second reply to the same request rejected");
+
+    // Queued request answered on the event loop thread
+    std::atomic<bool> called{ false };
+    AxPlug::RequestAsync(EVENT_TEST_QUERY, std::make_shared<LocalTestEvent>(), std::chrono::milliseconds(1000), [&](std::shared_ptr<AxPlug::AxEvent> r) {
+        called.store(r != nullptr);
+    }, AxPlug::DispatchMode::Queued);
+    for (int i = 0; i < 100 && !called.load(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(called.load(), "Continuation ran for a queued request");
+
+    auto start = std::chrono::steady_clock::now();
+    auto unanswered = AxPlug::Request(EVENT_TEST_NOBODY, std::make_shared<LocalTestEvent>(), std::chrono::milliseconds(50));
+    TEST_CHECK(unanswered.get() == nullptr, "Unanswered request yields nullptr");
+    TEST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(45), "Timeout honoured");
+
+    auto empty = AxPlug::Request(EVENT_TEST_QUERY, nullptr, std::chrono::milliseconds(1000));
+    TEST_CHECK(empty.wait_for(std::chrono::seconds(0)) == std::future_status::ready && empty.get() == nullptr, "Null request payload completes with nullptr at once");
+
+    std::cout << "=== Test 22 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 23: Coroutine awaitables - event_coro_test.cpp (AxEventCoro.h needs
+// C++20, this suite stays C++17)
+// ============================================================
+
+// ============================================================
+// Test 24: Slow-subscriber quarantine
+// ============================================================
+void testSlowSubscriberQuarantine()
+{
+    std::cout << "\n=== Test 24: Slow-Subscriber Quarantine ===" << std::endl;
+
+    const uint64_t EVENT_TEST_SLOW = AxPlug::HashEventId("Test::Slow");
+    AxPlug::SetSlowSubscriberPolicy(std::chrono::milliseconds(5), 2);
+
+    std::atomic<int> notices{ 0 };
+    auto watcher = AxPlug::Subscribe(AxPlug::EVENT_SUBSCRIBER_QUARANTINED, [&](const std::shared_ptr<AxPlug::AxEvent>& e) {
+        if (static_cast<AxPlug::SubscriberQuarantinedEvent*>(e.get())->eventId == EVENT_TEST_SLOW)
+            notices.fetch_add(1);
+    });
+    std::atomic<int> slowRuns{ 0 }, fastRuns{ 0 };
+    auto slow = AxPlug::Subscribe(EVENT_TEST_SLOW, [&](const std::shared_ptr<AxPlug::AxEvent>&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        slowRuns.fetch_add(1);
+    });
+    auto fast = AxPlug::Subscribe(EVENT_TEST_SLOW, [&](const std::shared_ptr<AxPlug::AxEvent>&) { fastRuns.fetch_add(1); });
+
+    // Two over-budget callbacks inline, then the subscriber moves to its own worker
+    AxPlug::Publish(EVENT_TEST_SLOW, std::make_shared<LocalTestEvent>());
+    AxPlug::Publish(EVENT_TEST_SLOW, std::make_shared<LocalTestEvent>());
+    AxPlug::EventStats stats;
+    AxPlug::GetEventBus()->GetEventStats(EVENT_TEST_SLOW, stats);
+    TEST_CHECK(stats.quarantined == 1, "Slow subscriber quarantined after two strikes");
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 5; ++i)
+        AxPlug::Publish(EVENT_TEST_SLOW, std::make_shared<LocalTestEvent>());
+    TEST_CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(20), "Publisher no longer blocked by the slow callback");
+    TEST_CHECK(fastRuns.load() == 7, "Healthy subscriber still runs inline");
+
+    for (int i = 0; i < 100 && (slowRuns.load() < 7 || notices.load() == 0); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(slowRuns.load() == 7, "Quarantined subscriber still receives every event");
+    TEST_CHECK(notices.load() == 1, "SubscriberQuarantined event published once");
+
+    slow->Disconnect();
+    AxPlug::SetSlowSubscriberPolicy(std::chrono::milliseconds(50), 0);
+    std::cout << "=== Test 24 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 25: Zero-copy byte-slice payloads
+// ============================================================
+void testBufferEvent()
+{
+    std::cout << "\n=== Test 25: AxBufferEvent ===" << std::endl;
+
+    const uint64_t EVENT_TEST_FRAME = AxPlug::HashEventId("Test::Frame");
+
+    std::vector<uint8_t> pixels(64 * 1024, 0x5A);
+    const uint8_t* raw = pixels.data();
+    auto frame = AxPlug::ByteSlice::Adopt(std::move(pixels));
+    TEST_CHECK(frame.data() == raw && frame.size() == 64 * 1024, "Adopt keeps the vector's storage");
+
+    auto row = frame.Slice(1024, 256);
+    TEST_CHECK(row.data() == raw + 1024 && row.size() == 256, "Slice shares the backing buffer");
+    TEST_CHECK(frame.Slice(frame.size() + 1).empty(), "Out-of-range slice is clamped to empty");
+
+    std::atomic<int> received{ 0 };
+    std::atomic<const uint8_t*> seen{ nullptr };
+    auto conn = AxPlug::Subscribe(EVENT_TEST_FRAME, [&](const std::shared_ptr<AxPlug::AxEvent>& e) {
+        seen.store(static_cast<AxPlug::AxBufferEvent*>(e.get())->bytes.data());
+        received.fetch_add(1);
+    });
+
+    AxPlug::Publish(EVENT_TEST_FRAME, AxPlug::MakeEvent<AxPlug::AxBufferEvent>(frame));
+    TEST_CHECK(seen.load() == raw, "DirectCall subscriber sees the publisher's bytes");
+
+    AxPlug::Publish(EVENT_TEST_FRAME, AxPlug::MakeEvent<AxPlug::AxBufferEvent>(row), AxPlug::DispatchMode::Queued);
+    for (int i = 0; i < 100 && received.load() < 2; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(seen.load() == raw + 1024, "Queued subscriber sees the same bytes");
+
+    AxPlug::AxBufferEvent copy;
+    copy.Deserialize(AxPlug::AxBufferEvent(row).Serialize());
+    TEST_CHECK(copy.bytes.size() == 256 && copy.bytes[0] == 0x5A && copy.bytes.data() != row.data(), "Serialize/Deserialize round trip copies");
+
+    std::cout << "=== Test 25 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 26: Sticky last-value events
+// ============================================================
+void testStickyEvents()
+{
+    std::cout << "\n=== Test 26: Sticky Events ===" << std::endl;
+
+    const uint64_t EVENT_TEST_CONFIG = AxPlug::HashEventId("Test::Config");
+    AxPlug::SetSticky(EVENT_TEST_CONFIG);
+
+    auto first = std::make_shared<LocalTestEvent>();
+    first->value = 1;
+    AxPlug::Publish(EVENT_TEST_CONFIG, first);
+    auto second = std::make_shared<LocalTestEvent>();
+    second->value = 2;
+    AxPlug::Publish(EVENT_TEST_CONFIG, second);
+
+    int seen = 0;
+    int calls = 0;
+    auto late = AxPlug::Subscribe(EVENT_TEST_CONFIG, [&](const std::shared_ptr<AxPlug::AxEvent>& e) {
+        seen = std::static_pointer_cast<LocalTestEvent>(e)->value;
+        ++calls;
+    });
+    TEST_CHECK(calls == 1 && seen == 2, "Late subscriber receives the last value inside Subscribe");
+
+    auto third = std::make_shared<LocalTestEvent>();
+    third->value = 3;
+    AxPlug::Publish(EVENT_TEST_CONFIG, third);
+    TEST_CHECK(calls == 2 && seen == 3, "Then receives live publishes as usual");
+
+    int otherSender = 0;
+    int filtered = 0;
+    auto wrongSender = AxPlug::Subscribe(EVENT_TEST_CONFIG, [&](const std::shared_ptr<AxPlug::AxEvent>&) { ++filtered; }, &otherSender);
+    TEST_CHECK(filtered == 0, "Sticky value respects the sender filter");
+
+    // Subscribe while another thread publishes (singly and in batches): each new
+    // subscriber gets the stored value or the live publish, never both
+    {
+        struct Seen
+        {
+            std::mutex mutex;
+            std::vector<int> values;
+        };
+        std::atomic<bool> publishing{ true };
+        std::thread publisher([&]() {
+            for (int v = 10; v < 6010; v += 3)
+            {
+                auto a = std::make_shared<LocalTestEvent>();
+                a->value = v;
+                AxPlug::Publish(EVENT_TEST_CONFIG, a);
+                auto b = std::make_shared<LocalTestEvent>();
+                b->value = v + 1;
+                auto c = std::make_shared<LocalTestEvent>();
+                c->value = v + 2;
+                AxPlug::PublishBatch(EVENT_TEST_CONFIG, { b, c });
+            }
+            publishing = false;
+        });
+        std::vector<std::unique_ptr<Seen>> seenBy;
+        std::vector<AxPlug::EventConnectionPtr> racing;
+        while (publishing)
+        {
+            seenBy.push_back(std::make_unique<Seen>());
+            Seen* s = seenBy.back().get();
+            racing.push_back(AxPlug::Subscribe(EVENT_TEST_CONFIG, [s](const std::shared_ptr<AxPlug::AxEvent>& e) {
+                std::lock_guard<std::mutex> lock(s->mutex);
+                s->values.push_back(std::static_pointer_cast<LocalTestEvent>(e)->value);
+            }));
+            if (racing.size() > 64)
+                racing.erase(racing.begin());
+        }
+        publisher.join();
+        racing.clear();
+        size_t repeated = 0;
+        for (auto& s : seenBy)
+        {
+            // The sticky value is handed over on this thread and may land after the
+            // first live ones, so compare as a set: no value may arrive twice
+            std::lock_guard<std::mutex> lock(s->mutex);
+            std::vector<int> sorted = s->values;
+            std::sort(sorted.begin(), sorted.end());
+            if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+                ++repeated;
+        }
+        TEST_CHECK(!seenBy.empty() && repeated == 0, "Concurrent subscribers never get the sticky value and the live publish");
+    }
+
+    AxPlug::SetSticky(EVENT_TEST_CONFIG, false);
+    int afterDisable = 0;
+    auto none = AxPlug::Subscribe(EVENT_TEST_CONFIG, [&](const std::shared_ptr<AxPlug::AxEvent>&) { ++afterDisable; });
+    TEST_CHECK(afterDisable == 0, "Disabling sticky drops the stored value");
+
+    std::cout << "=== Test 26 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 27: Span-based networkable events
+// ============================================================
+void testSpanSerialization()
+{
+    std::cout << "\n=== Test 27: Span Serialization ===" << std::endl;
+
+    SpanTestEvent point;
+    point.x = 7;
+    point.y = -3;
+
+    std::vector<uint8_t> scratch;
+    size_t size = 0;
+    TEST_CHECK(point.SerializeInto(scratch, size) && size == 8, "V2 event serializes into the caller's buffer");
+    const uint8_t* first = scratch.data();
+    TEST_CHECK(point.SerializeInto(scratch, size) && scratch.data() == first, "Buffer is reused on the next call");
+
+    SpanTestEvent decoded;
+    decoded.DeserializeFrom(scratch.data(), size);
+    TEST_CHECK(decoded.x == 7 && decoded.y == -3, "DeserializeFrom reads the span");
+
+    SpanTestEvent viaString;
+    viaString.Deserialize(point.Serialize());
+    TEST_CHECK(viaString.x == 7 && viaString.y == -3, "std::string Serialize/Deserialize derived from the span API");
+
+    NetworkTestEvent legacy;
+    legacy.payload = "v1";
+    TEST_CHECK(!legacy.SerializeInto(scratch, size), "V1 event has no size hint");
+    uint8_t out[8];
+    TEST_CHECK(legacy.SerializeTo(out, sizeof(out)) == 2 && legacy.SerializeTo(out, 1) == AxPlug::INetworkableEvent::SERIALIZE_OVERFLOW, "V1 SerializeTo falls back to Serialize");
+    NetworkTestEvent legacyCopy;
+    legacyCopy.DeserializeFrom(reinterpret_cast<const uint8_t*>("abc"), 3);
+    TEST_CHECK(legacyCopy.payload == "abc", "V1 DeserializeFrom falls back to Deserialize");
+
+    // Journal record and replay go through the span API
+    const char* journalPath = "event_bus_span_test.journal";
+    const uint64_t EVENT_TEST_POINT = AxPlug::HashEventId("Test::Point");
+    std::remove(journalPath);
+    AxPlug::OpenJournal(journalPath, 1 << 20);
+    AxPlug::JournalEvent(EVENT_TEST_POINT, []() { return std::make_shared<SpanTestEvent>(); });
+    auto from = std::chrono::system_clock::now();
+    AxPlug::Publish(EVENT_TEST_POINT, std::make_shared<SpanTestEvent>(point));
+    auto to = std::chrono::system_clock::now();
+
+    int replayedX = 0;
+    auto conn = AxPlug::Subscribe(EVENT_TEST_POINT, [&](const std::shared_ptr<AxPlug::AxEvent>& evt) {
+        replayedX = std::static_pointer_cast<SpanTestEvent>(evt)->x;
+    });
+    TEST_CHECK(AxPlug::ReplayJournal(from, to) == 1 && replayedX == 7, "V2 event journaled and replayed");
+    AxPlug::GetEventBus()->CloseJournal();
+    std::remove(journalPath);
+
+    std::cout << "=== Test 27 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 28: Shared-memory loopback between two bus instances
+// ============================================================
+void testShmLoopback()
+{
+    std::cout << "\n=== Test 28: Shared-Memory Loopback ===" << std::endl;
+
+    // Named services are independent instances; keep both wrapping the original bus
+    auto* originalBus = AxPlug::GetEventBus();
+    auto busA = AxPlug::GetService<AxPlug::IShmEventBus>("loopA");
+    AxPlug::SetEventBus(originalBus);
+    auto busB = AxPlug::GetService<AxPlug::IShmEventBus>("loopB");
+    AxPlug::SetEventBus(originalBus);
+    if (!busA || !busB)
+    {
+        std::cout << "  [SKIP] ShmEventBusPlugin not loaded (DLL not found)" << std::endl;
+        return;
+    }
+
+    busA->RegisterNetworkableEvent(EVENT_TEST_NETWORK, []() { return std::make_shared<NetworkTestEvent>(); });
+    busB->RegisterNetworkableEvent(EVENT_TEST_NETWORK, []() { return std::make_shared<NetworkTestEvent>(); });
+    std::string segmentName = "AxPlugEventBusLoop." + std::to_string(GetCurrentProcessId());
+    bool started = busA->StartShm(segmentName.c_str(), 64 * 1024) && busB->StartShm(segmentName.c_str(), 64 * 1024);
+    TEST_CHECK(started, "Two instances attached to one segment");
+
+    // A dispatches its own event object locally; B re-publishes a deserialized copy
+    std::shared_ptr<NetworkTestEvent> published;
+    std::mutex receivedMutex;
+    std::vector<std::string> received;
+    auto conn = AxPlug::Subscribe(EVENT_TEST_NETWORK, [&](const std::shared_ptr<AxPlug::AxEvent>& evt) {
+        if (evt == published)
+            return;
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        received.push_back(static_cast<NetworkTestEvent*>(evt.get())->payload);
+    });
+    auto receivedCount = [&]() {
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        return received.size();
+    };
+
+    published = std::make_shared<NetworkTestEvent>();
+    published->payload = "over_shm";
+    busA->AsEventBus()->Publish(EVENT_TEST_NETWORK, published);
+    for (int i = 0; i < 100 && receivedCount() < 1; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(receivedCount() == 1 && received[0] == "over_shm", "Record written by A is drained by B");
+
+    // Simulate a producer that died between reserving and committing: bump the
+    // head of B's inbox (slot 1; slot heads sit at 64 + slot * 192 + 64)
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, ("Local\\" + segmentName).c_str());
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 4096) : nullptr;
+    TEST_CHECK(view != nullptr, "Segment mapped by name");
+    if (view)
+    {
+        reinterpret_cast<std::atomic<uint64_t>*>(static_cast<char*>(view) + 64 + 192 + 64)->fetch_add(64);
+        UnmapViewOfFile(view);
+    }
+    if (mapping)
+        CloseHandle(mapping);
+
+    // The stalled bytes are stepped over after ShmSegment::STALL_TIMEOUT_MS
+    std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+    published = std::make_shared<NetworkTestEvent>();
+    published->payload = "after_stall";
+    busA->AsEventBus()->Publish(EVENT_TEST_NETWORK, published);
+    for (int i = 0; i < 100 && receivedCount() < 2; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    TEST_CHECK(receivedCount() == 2 && received[1] == "after_stall", "Inbox recovers from an uncommitted reservation");
+    TEST_CHECK(busA->GetDroppedCount() == 0, "No drops");
+
+    conn.reset();
+    busA->StopShm();
+    busB->StopShm();
+    busA.reset();
+    busB.reset();
+    AxPlug::ReleaseService<AxPlug::IShmEventBus>("loopB");
+    AxPlug::ReleaseService<AxPlug::IShmEventBus>("loopA");
+    TEST_CHECK(AxPlug::GetEventBus() == originalBus, "Original bus restored after both instances release");
+
+    std::cout << "=== Test 28 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 29: Network loopback between two bus instances
+// ============================================================
+constexpr uint64_t EVENT_TEST_LOSSY = AxPlug::HashEventId("Test::LossyPeer");
+
+// Appends a little-endian field to a hand-built datagram
+static void putWire(std::vector<uint8_t>& out, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i)
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+void testNetworkLoopback()
+{
+    std::cout << "\n=== Test 29: Network Loopback ===" << std::endl;
+
+    // Named services are independent instances; keep both wrapping the original bus
+    auto* originalBus = AxPlug::GetEventBus();
+    auto busA = AxPlug::GetService<AxPlug::INetworkEventBus>("loopA");
+    AxPlug::SetEventBus(originalBus);
+    auto busB = AxPlug::GetService<AxPlug::INetworkEventBus>("loopB");
+    AxPlug::SetEventBus(originalBus);
+    if (!busA || !busB)
+    {
+        std::cout << "  [SKIP] NetworkEventBusPlugin not loaded (DLL not found)" << std::endl;
+        return;
+    }
+
+    // Only B knows the lossy peer's event, so A ignores that peer's traffic
+    busA->RegisterNetworkableEvent(EVENT_TEST_NETWORK, []() { return std::make_shared<NetworkTestEvent>(); });
+    busB->RegisterNetworkableEvent(EVENT_TEST_NETWORK, []() { return std::make_shared<NetworkTestEvent>(); });
+    busB->RegisterNetworkableEvent(EVENT_TEST_LOSSY, []() { return std::make_shared<NetworkTestEvent>(); });
+    busA->SetReliableDelivery(1 << 20);
+    busB->SetReliableDelivery(1 << 20);
+    const char* group = "239.255.0.47";
+    const int port = 30000 + static_cast<int>(GetCurrentProcessId() % 20000);
+    bool started = busA->StartNetwork(group, port) && busB->StartNetwork(group, port);
+    TEST_CHECK(started, "Two instances joined one multicast group");
+    if (!started)
+    {
+        busA->StopNetwork();
+        busA.reset();
+        busB.reset();
+        AxPlug::ReleaseService<AxPlug::INetworkEventBus>("loopB");
+        AxPlug::ReleaseService<AxPlug::INetworkEventBus>("loopA");
+        return;
+    }
+
+    // A dispatches its own event object locally; B re-publishes a deserialized copy
+    std::shared_ptr<NetworkTestEvent> published;
+    std::mutex receivedMutex;
+    std::vector<std::string> received, lossy;
+    auto conn = AxPlug::Subscribe(EVENT_TEST_NETWORK, [&](const std::shared_ptr<AxPlug::AxEvent>& evt) {
+        if (evt == published)
+            return;
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        received.push_back(static_cast<NetworkTestEvent*>(evt.get())->payload);
+    });
+    auto lossyConn = AxPlug::Subscribe(EVENT_TEST_LOSSY, [&](const std::shared_ptr<AxPlug::AxEvent>& evt) {
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        lossy.push_back(static_cast<NetworkTestEvent*>(evt.get())->payload);
+    });
+    auto countOf = [&](const std::vector<std::string>& list) {
+        std::lock_guard<std::mutex> lock(receivedMutex);
+        return list.size();
+    };
+    auto waitFor = [](const std::function<bool()>& done) {
+        for (int i = 0; i < 100 && !done(); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    };
+
+    published = std::make_shared<NetworkTestEvent>();
+    published->payload = "over_udp";
+    busA->AsEventBus()->Publish(EVENT_TEST_NETWORK, published);
+    waitFor([&]() { return countOf(received) >= 1; });
+    TEST_CHECK(countOf(received) == 1 && received[0] == "over_udp", "Datagram sent by A is received by B");
+
+    published = std::make_shared<NetworkTestEvent>();
+    published->payload.assign(200000, 'z');
+    busA->AsEventBus()->Publish(EVENT_TEST_NETWORK, published);
+    waitFor([&]() { return countOf(received) >= 2; });
+    TEST_CHECK(countOf(received) == 2 && received[1].size() == 200000, "Fragmented event reassembled by B");
+    TEST_CHECK(busA->GetTransportStats().fragmentedSent == 1 && busB->GetTransportStats().reassembled == 1,
+               "Fragment counters agree on both ends");
+
+    // A third node on a raw socket sends sequenced datagrams 1 and 3; 2 is "lost"
+    AxPlug::GetWinsockInit();
+    SOCKET peer = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    TEST_CHECK(peer != INVALID_SOCKET, "Lossy peer socket created");
+    sockaddr_in to = {};
+    to.sin_family = AF_INET;
+    to.sin_port = htons(static_cast<uint16_t>(port));
+    inet_pton(AF_INET, group, &to.sin_addr);
+    const uint64_t peerNode = 0xF00DF00DF00DF00Dull;
+    auto sendRaw = [&](const std::vector<uint8_t>& datagram) {
+        sendto(peer, reinterpret_cast<const char*>(datagram.data()), static_cast<int>(datagram.size()), 0,
+               reinterpret_cast<const sockaddr*>(&to), sizeof(to));
+    };
+    // [seq][node][RELIABLE|len] wrapping a plain [eventId][node][len] + payload datagram
+    auto sendSequenced = [&](uint64_t seq, const std::string& text) {
+        std::vector<uint8_t> datagram;
+        putWire(datagram, seq, 8);
+        putWire(datagram, peerNode, 8);
+        putWire(datagram, 0x20000000u | static_cast<uint32_t>(20 + text.size()), 4);
+        putWire(datagram, EVENT_TEST_LOSSY, 8);
+        putWire(datagram, peerNode, 8);
+        putWire(datagram, text.size(), 4);
+        datagram.insert(datagram.end(), text.begin(), text.end());
+        sendRaw(datagram);
+    };
+
+    uint64_t naksBefore = busB->GetTransportStats().naksSent;
+    sendSequenced(1, "lossy-1");
+    sendSequenced(3, "lossy-3");
+    waitFor([&]() { return countOf(lossy) >= 1 && busB->GetTransportStats().naksSent > naksBefore; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TEST_CHECK(countOf(lossy) == 1 && lossy[0] == "lossy-1", "Datagram after the gap is held back");
+    TEST_CHECK(busB->GetTransportStats().naksSent > naksBefore, "Gap answered with a NAK");
+
+    sendSequenced(2, "lossy-2");
+    waitFor([&]() { return countOf(lossy) >= 3; });
+    TEST_CHECK(countOf(lossy) == 3 && lossy[1] == "lossy-2" && lossy[2] == "lossy-3", "Recovered datagram delivered in order");
+    TEST_CHECK(busB->GetTransportStats().datagramsRecovered >= 1, "Recovery counted");
+
+    // NAK A's first datagram on B's behalf: A retransmits it and B drops the duplicate
+    uint64_t duplicatesBefore = busB->GetTransportStats().duplicatesDropped;
+    std::vector<uint8_t> nak;
+    putWire(nak, 1, 8); // CONTROL_NAK
+    putWire(nak, peerNode, 8);
+    putWire(nak, 0x10000000u | 20u, 4);
+    putWire(nak, busA->GetNodeId(), 8);
+    putWire(nak, 1, 8);
+    putWire(nak, 1, 4);
+    sendRaw(nak);
+    waitFor([&]() { return busB->GetTransportStats().duplicatesDropped > duplicatesBefore; });
+    TEST_CHECK(busA->GetTransportStats().retransmits >= 1, "Sender retransmits a NAKed datagram");
+    TEST_CHECK(busB->GetTransportStats().duplicatesDropped > duplicatesBefore && countOf(received) == 2,
+               "Retransmitted duplicate dropped, not re-delivered");
+    closesocket(peer);
+
+    conn.reset();
+    lossyConn.reset();
+    busA->StopNetwork();
+    busB->StopNetwork();
+    busA.reset();
+    busB.reset();
+    AxPlug::ReleaseService<AxPlug::INetworkEventBus>("loopB");
+    AxPlug::ReleaseService<AxPlug::INetworkEventBus>("loopA");
+    TEST_CHECK(AxPlug::GetEventBus() == originalBus, "Original bus restored after both instances release");
+
+    std::cout << "=== Test 29 Complete ===" << std::endl;
+}
+
 // ============================================================
 // main
 // ============================================================
@@ -353,8 +1575,28 @@ int main()
         testMultipleSubscribers();
         testAsyncDispatch();
         testAntiStormWhitelist();
+        testPooledEvents();
+        testPublishBatch();
+        testMailboxDelivery();
+        testInlineHandlers();
+        testPriorityLanes();
+        testTimedPublish();
+        testEventStats();
+        testSenderIndex();
+        testTopicPatterns();
+        testEventJournal();
+        testParallelDispatch();
+        testBulkSubscribe();
+        testRequestReply();
+        testSlowSubscriberQuarantine();
+        testBufferEvent();
+        testStickyEvents();
+        testSpanSerialization();
         testNetworkEventBusTakeover();
         testBusRestoration();
+        testShmEventBusTakeover();
+        testShmLoopback();
+        testNetworkLoopback();
     }
     catch (const std::exception& e)
     {
@@ -0,0 +1,331 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <windows.h>
+
+#include "AxPlug/AxPlug.h"
+#include "AxPlug/AxEventCoro.h" // C++20: this target is built with CXX_STANDARD 20
+
+// ============================================================
+// Test event definitions
+// ============================================================
+class CoroTestEvent : public AxPlug::AxEvent
+{
+public:
+    int value = 0;
+};
+
+// State shared between a test and its coroutine. Coroutines take it by
+// shared_ptr so a check that gives up early never leaves a dangling frame.
+struct Probe
+{
+    std::atomic<int> stage{ 0 };
+    std::atomic<int> value{ 0 };
+    std::atomic<bool> done{ false };
+    std::thread::id resumedOn; // written before `done` is set
+};
+
+// ============================================================
+// Test counters
+// ============================================================
+static int g_passed = 0;
+static int g_failed = 0;
+
+#define TEST_CHECK(cond, msg) \
+    do { \
+        if (cond) { std::cout << "  [PASS] " << (msg) << std::endl; ++g_passed; } \
+        else { std::cout << "  [FAIL] " << (msg) << std::endl; ++g_failed; } \
+    } while(0)
+
+static bool waitDone(const Probe& probe)
+{
+    for (int i = 0; i < 200 && !probe.done.load(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return probe.done.load();
+}
+
+static std::shared_ptr<CoroTestEvent> makeValue(int value)
+{
+    auto evt = std::make_shared<CoroTestEvent>();
+    evt->value = value;
+    return evt;
+}
+
+static int valueOf(const std::shared_ptr<AxPlug::AxEvent>& evt)
+{
+    return evt ? std::static_pointer_cast<CoroTestEvent>(evt)->value : -1;
+}
+
+static size_t subscribersOf(uint64_t eventId)
+{
+    AxPlug::EventStats stats;
+    return AxPlug::GetEventBus()->GetEventStats(eventId, stats) ? stats.subscribers : 0;
+}
+
+// ============================================================
+// Test 1: Next() resumes on the event loop, then times out
+// ============================================================
+static AxPlug::Coro::Task awaitTwice(AxPlug::IEventBus& bus, uint64_t eventId, std::shared_ptr<Probe> probe)
+{
+    auto first = co_await AxPlug::Coro::Next(bus, eventId, nullptr, std::chrono::milliseconds(1000));
+    probe->resumedOn = std::this_thread::get_id();
+    probe->value = valueOf(first);
+    probe->stage = 1;
+    auto second = co_await AxPlug::Coro::Next(bus, eventId, nullptr, std::chrono::milliseconds(20));
+    probe->stage = second ? -1 : 2;
+    probe->done = true;
+}
+
+void testNextAndTimeout()
+{
+    std::cout << "\n=== Test 1: Next() and Timeout ===" << std::endl;
+
+    const uint64_t EVENT_CORO_ACK = AxPlug::HashEventId("CoroTest::Ack");
+    auto probe = std::make_shared<Probe>();
+    awaitTwice(*AxPlug::GetEventBus(), EVENT_CORO_ACK, probe);
+    TEST_CHECK(probe->stage == 0, "Coroutine suspended on Next()");
+    TEST_CHECK(subscribersOf(EVENT_CORO_ACK) == 1, "Awaiter holds one subscription while suspended");
+
+    AxPlug::Publish(EVENT_CORO_ACK, makeValue(5));
+    TEST_CHECK(waitDone(*probe) && probe->value == 5, "Resumed with the published event");
+    TEST_CHECK(probe->stage == 2, "Second Next() timed out with nullptr");
+    TEST_CHECK(probe->resumedOn != std::this_thread::get_id(), "Resumed on the event loop thread, not the publisher");
+    TEST_CHECK(subscribersOf(EVENT_CORO_ACK) == 0, "Subscription released after resume and after timeout");
+
+    std::cout << "=== Test 1 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 2: ResumeOn::Inline continues on the publishing thread
+// ============================================================
+static AxPlug::Coro::Task awaitInline(AxPlug::IEventBus& bus, uint64_t eventId, std::shared_ptr<Probe> probe)
+{
+    auto evt = co_await AxPlug::Coro::Next(bus, eventId, nullptr, std::chrono::milliseconds(1000), AxPlug::Coro::ResumeOn::Inline);
+    probe->resumedOn = std::this_thread::get_id();
+    probe->value = valueOf(evt);
+    probe->done = true;
+}
+
+void testInlineResume()
+{
+    std::cout << "\n=== Test 2: Inline Resume ===" << std::endl;
+
+    const uint64_t EVENT_CORO_INLINE = AxPlug::HashEventId("CoroTest::Inline");
+    auto probe = std::make_shared<Probe>();
+    awaitInline(*AxPlug::GetEventBus(), EVENT_CORO_INLINE, probe);
+    TEST_CHECK(!probe->done, "Coroutine suspended");
+
+    AxPlug::Publish(EVENT_CORO_INLINE, makeValue(9));
+    TEST_CHECK(probe->done && probe->value == 9, "Resumed before Publish returned");
+    TEST_CHECK(probe->resumedOn == std::this_thread::get_id(), "Resumed on the publishing thread");
+
+    std::cout << "=== Test 2 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 3: completion while the awaiter is still suspending
+// A sticky value is delivered inside Subscribe, i.e. inside await_suspend,
+// before ResumeState::Suspend has run: the hand-off must resume exactly once.
+// ============================================================
+static AxPlug::Coro::Task awaitSticky(AxPlug::IEventBus& bus, uint64_t eventId, AxPlug::Coro::ResumeOn resumeOn, std::shared_ptr<Probe> probe)
+{
+    auto evt = co_await AxPlug::Coro::Next(bus, eventId, nullptr, std::chrono::milliseconds(1000), resumeOn);
+    probe->resumedOn = std::this_thread::get_id();
+    probe->value = valueOf(evt);
+    probe->stage.fetch_add(1);
+    probe->done = true;
+}
+
+void testCompletionDuringSuspend()
+{
+    std::cout << "\n=== Test 3: Completion During Suspend ===" << std::endl;
+
+    const uint64_t EVENT_CORO_STICKY = AxPlug::HashEventId("CoroTest::Sticky");
+    AxPlug::SetSticky(EVENT_CORO_STICKY);
+    AxPlug::Publish(EVENT_CORO_STICKY, makeValue(3));
+
+    auto inlineProbe = std::make_shared<Probe>();
+    awaitSticky(*AxPlug::GetEventBus(), EVENT_CORO_STICKY, AxPlug::Coro::ResumeOn::Inline, inlineProbe);
+    TEST_CHECK(inlineProbe->done && inlineProbe->value == 3, "Inline awaiter completed without suspending");
+    TEST_CHECK(inlineProbe->resumedOn == std::this_thread::get_id(), "Inline awaiter continued on the awaiting thread");
+
+    auto loopProbe = std::make_shared<Probe>();
+    awaitSticky(*AxPlug::GetEventBus(), EVENT_CORO_STICKY, AxPlug::Coro::ResumeOn::EventLoop, loopProbe);
+    TEST_CHECK(waitDone(*loopProbe) && loopProbe->value == 3, "EventLoop awaiter resumed with the sticky value");
+    TEST_CHECK(loopProbe->resumedOn != std::this_thread::get_id(), "EventLoop awaiter resumed on the event loop thread");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    TEST_CHECK(inlineProbe->stage == 1 && loopProbe->stage == 1, "Each coroutine resumed exactly once");
+    AxPlug::SetSticky(EVENT_CORO_STICKY, false);
+
+    std::cout << "=== Test 3 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 4: an event beating the timeout cancels the timer
+// ============================================================
+static AxPlug::Coro::Task awaitBeforeTimeout(AxPlug::IEventBus& bus, uint64_t eventId, std::shared_ptr<Probe> probe)
+{
+    auto evt = co_await AxPlug::Coro::Next(bus, eventId, nullptr, std::chrono::milliseconds(50));
+    probe->value = valueOf(evt);
+    probe->stage.fetch_add(1);
+    // Outlive the cancelled timeout: a second completion would show up here
+    co_await AxPlug::Coro::Delay(bus, std::chrono::milliseconds(150));
+    probe->done = true;
+}
+
+void testTimeoutCancelled()
+{
+    std::cout << "\n=== Test 4: Timeout Cancelled ===" << std::endl;
+
+    const uint64_t EVENT_CORO_RACE = AxPlug::HashEventId("CoroTest::Race");
+    auto probe = std::make_shared<Probe>();
+    awaitBeforeTimeout(*AxPlug::GetEventBus(), EVENT_CORO_RACE, probe);
+    AxPlug::Publish(EVENT_CORO_RACE, makeValue(11));
+    TEST_CHECK(waitDone(*probe), "Coroutine ran to completion");
+    TEST_CHECK(probe->value == 11 && probe->stage == 1, "Resumed once, with the event, not by the timeout");
+
+    std::cout << "=== Test 4 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 5: Request() awaiter - reply, timeout, null payload
+// ============================================================
+static AxPlug::Coro::Task awaitRequests(AxPlug::IEventBus& bus, uint64_t queryId, uint64_t nobodyId, std::shared_ptr<Probe> probe)
+{
+    auto reply = co_await AxPlug::Coro::Request(bus, queryId, makeValue(41), std::chrono::milliseconds(1000));
+    probe->value = valueOf(reply);
+    auto start = std::chrono::steady_clock::now();
+    auto unanswered = co_await AxPlug::Coro::Request(bus, nobodyId, makeValue(0), std::chrono::milliseconds(50));
+    bool waited = std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(45);
+    auto empty = co_await AxPlug::Coro::Request(bus, queryId, nullptr, std::chrono::milliseconds(1000));
+    probe->stage = (!unanswered && waited ? 1 : 0) + (!empty ? 2 : 0);
+    probe->resumedOn = std::this_thread::get_id();
+    probe->done = true;
+}
+
+void testRequestAwaiter()
+{
+    std::cout << "\n=== Test 5: Request Awaiter ===" << std::endl;
+
+    const uint64_t EVENT_CORO_QUERY = AxPlug::HashEventId("CoroTest::Query");
+    const uint64_t EVENT_CORO_NOBODY = AxPlug::HashEventId("CoroTest::Nobody");
+    auto responder = AxPlug::Subscribe(EVENT_CORO_QUERY, [](const std::shared_ptr<AxPlug::AxEvent>& request) {
+        if (request)
+            AxPlug::Reply(*request, makeValue(valueOf(request) + 1));
+    });
+
+    auto probe = std::make_shared<Probe>();
+    awaitRequests(*AxPlug::GetEventBus(), EVENT_CORO_QUERY, EVENT_CORO_NOBODY, probe);
+    TEST_CHECK(waitDone(*probe), "Coroutine ran to completion");
+    TEST_CHECK(probe->value == 42, "Reply returned from co_await");
+    TEST_CHECK((probe->stage & 1) != 0, "Unanswered request yields nullptr after the timeout");
+    TEST_CHECK((probe->stage & 2) != 0, "Null request payload yields nullptr");
+    TEST_CHECK(probe->resumedOn != std::this_thread::get_id(), "Continued on the event loop thread");
+
+    std::cout << "=== Test 5 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 6: EventStream buffers between awaits
+// ============================================================
+static AxPlug::Coro::Task sumStream(AxPlug::Coro::EventStream& stream, int count, std::shared_ptr<Probe> probe)
+{
+    int sum = 0;
+    for (int i = 0; i < count; ++i)
+        sum += valueOf(co_await stream.Next());
+    probe->value = sum;
+    probe->done = true;
+}
+
+void testEventStream()
+{
+    std::cout << "\n=== Test 6: EventStream ===" << std::endl;
+
+    const uint64_t EVENT_CORO_SAMPLE = AxPlug::HashEventId("CoroTest::Sample");
+    {
+        AxPlug::Coro::EventStream samples(*AxPlug::GetEventBus(), EVENT_CORO_SAMPLE);
+        auto probe = std::make_shared<Probe>();
+        AxPlug::Publish(EVENT_CORO_SAMPLE, makeValue(1)); // buffered before the first await
+        sumStream(samples, 4, probe);
+        AxPlug::Publish(EVENT_CORO_SAMPLE, makeValue(2));
+        AxPlug::Publish(EVENT_CORO_SAMPLE, makeValue(3));
+        AxPlug::Publish(EVENT_CORO_SAMPLE, makeValue(4));
+        TEST_CHECK(waitDone(*probe) && probe->value == 10, "Events published between awaits are buffered, none missed");
+        TEST_CHECK(samples.Dropped() == 0, "Nothing dropped");
+    }
+    {
+        AxPlug::Coro::EventStream bounded(*AxPlug::GetEventBus(), EVENT_CORO_SAMPLE, nullptr, AxPlug::Coro::ResumeOn::EventLoop, 2);
+        for (int i = 0; i < 5; ++i)
+            AxPlug::Publish(EVENT_CORO_SAMPLE, makeValue(i));
+        TEST_CHECK(bounded.Dropped() == 3, "Oldest events dropped beyond capacity");
+    }
+    TEST_CHECK(subscribersOf(EVENT_CORO_SAMPLE) == 0, "Destroying the stream unsubscribes");
+
+    std::cout << "=== Test 6 Complete ===" << std::endl;
+}
+
+// ============================================================
+// Test 7: Delay / SwitchToEventLoop
+// ============================================================
+static AxPlug::Coro::Task delayThenSwitch(AxPlug::IEventBus& bus, std::shared_ptr<Probe> probe)
+{
+    auto start = std::chrono::steady_clock::now();
+    co_await AxPlug::Coro::Delay(bus, std::chrono::milliseconds(30));
+    probe->value = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    co_await AxPlug::Coro::SwitchToEventLoop(bus);
+    probe->resumedOn = std::this_thread::get_id();
+    probe->done = true;
+}
+
+void testDelay()
+{
+    std::cout << "\n=== Test 7: Delay ===" << std::endl;
+
+    auto probe = std::make_shared<Probe>();
+    delayThenSwitch(*AxPlug::GetEventBus(), probe);
+    TEST_CHECK(waitDone(*probe), "Coroutine ran to completion");
+    TEST_CHECK(probe->value >= 30, "Delay never resumes early");
+    TEST_CHECK(probe->resumedOn != std::this_thread::get_id(), "Continues on the event loop thread");
+
+    std::cout << "=== Test 7 Complete ===" << std::endl;
+}
+
+// ============================================================
+// main
+// ============================================================
+int main()
+{
+    SetConsoleOutputCP(65001);
+    SetConsoleCP(65001);
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "  AxPlug Event Coroutine Test Suite" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    try
+    {
+        AxPlug::Init();
+
+        testNextAndTimeout();
+        testInlineResume();
+        testCompletionDuringSuspend();
+        testTimeoutCancelled();
+        testRequestAwaiter();
+        testEventStream();
+        testDelay();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "\n[EXCEPTION] " << e.what() << std::endl;
+        ++g_failed;
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "  Results: " << g_passed << " passed, " << g_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return g_failed > 0 ? 1 : 0;
+}